@@ -120,5 +120,7 @@ enum class SfpuType
     unary_min_int32,
     unary_max_uint32,
     unary_min_uint32,
+    rope,
+    mish,
 };
 #endif // ARCH_QUASAR
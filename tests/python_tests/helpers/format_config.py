@@ -59,6 +59,7 @@ class DataFormat(Enum):
     Float16_b = DataFormatInfo("Float16_b", 2)
     Bfp8 = DataFormatInfo("Bfp8", 1)
     Bfp8_b = DataFormatInfo("Bfp8_b", 1)
+    Bfp4_b = DataFormatInfo("Bfp4_b", 1)  # two datums per byte, see num_bytes_per_tile
     Float32 = DataFormatInfo("Float32", 4)
     Int32 = DataFormatInfo("Int32", 4)
     Tf32 = DataFormatInfo("Tf32", 3)
@@ -97,6 +98,7 @@ class DataFormat(Enum):
         return self in {
             DataFormat.Float16_b,
             DataFormat.Bfp8_b,
+            DataFormat.Bfp4_b,
             DataFormat.Tf32,
             DataFormat.Float32,
         }
@@ -106,6 +108,9 @@ class DataFormat(Enum):
         num_exponents = 0
         if self in {DataFormat.Bfp8, DataFormat.Bfp8_b}:
             num_exponents = num_datums // 16
+        elif self == DataFormat.Bfp4_b:
+            # 4-bit sign-magnitude mantissas, two per byte
+            return (num_datums // 2) + (num_datums // 16)
         elif self.is_mx_format():
             # MX formats: 1 scale (E8M0, 8 bits) per 32 elements
             num_exponents = num_datums // 32
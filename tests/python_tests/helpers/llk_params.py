@@ -13,6 +13,7 @@ format_dict = {
     DataFormat.Float16: torch.float16,
     DataFormat.Float16_b: torch.bfloat16,
     DataFormat.Bfp8_b: torch.bfloat16,  # BFP8 not native to PyTorch, is represented as bfloat16
+    DataFormat.Bfp4_b: torch.bfloat16,
     DataFormat.Int32: torch.int32,
     DataFormat.UInt32: torch.int64,
     DataFormat.UInt16: torch.int32,
@@ -78,6 +79,7 @@ class MathOperation(Enum):
     Reciprocal = OpSpec("reciprocal", MathOpType.SFPU_UNARY)
     Relu = OpSpec("relu", MathOpType.SFPU_UNARY)
     Rsqrt = OpSpec("rsqrt", MathOpType.SFPU_UNARY)
+    Sigmoid = OpSpec("sigmoid", MathOpType.SFPU_UNARY)
     Sin = OpSpec("sine", MathOpType.SFPU_UNARY)
     Silu = OpSpec("silu", MathOpType.SFPU_UNARY)
     Sqrt = OpSpec("sqrt", MathOpType.SFPU_UNARY)
@@ -206,6 +208,12 @@ class StochasticRounding(Enum):
     All = "StochRndType::All"
 
 
+class MatmulReuse(Enum):
+    Auto = "MatmulReuse::Auto"
+    In0 = "MatmulReuse::In0"
+    In1 = "MatmulReuse::In1"
+
+
 class PackerReluType(Enum):
     """
     Relu activation function types for packer operations.
@@ -334,6 +342,77 @@ class StableSort(Enum):
             return "false"
 
 
+class RopeMode(Enum):
+    Interleaved = "Interleaved"
+    HalfSplit = "HalfSplit"
+
+    @property
+    def cpp_enum_value(self):
+        return f"ckernel::RopeMode::{self.value}"
+
+
+class SfpuAccuracy(Enum):
+    Fp32 = "Fp32"
+    Bf16 = "Bf16"
+    FastApprox = "FastApprox"
+
+    @property
+    def cpp_enum_value(self):
+        return f"ckernel::SfpuAccuracy::{self.value}"
+
+
+class Fp8Format(Enum):
+    E4M3 = "E4M3"
+    E5M2 = "E5M2"
+
+    @property
+    def cpp_enum_value(self):
+        return f"ckernel::Fp8Format::{self.value}"
+
+
+class MxFormat(Enum):
+    MxFp4 = "MxFp4"
+    MxFp6E2M3 = "MxFp6E2M3"
+    MxFp6E3M2 = "MxFp6E3M2"
+    MxInt8 = "MxInt8"
+
+    @property
+    def cpp_enum_value(self):
+        return f"ckernel::MxFormat::{self.value}"
+
+
+class LutSymmetry(Enum):
+    Clamp = "Clamp"
+    Even = "Even"
+    Odd = "Odd"
+
+    @property
+    def cpp_enum_value(self):
+        return f"ckernel::LutSymmetry::{self.value}"
+
+
+class TernaryOp(Enum):
+    Fma = "FMA"
+    Lerp = "LERP"
+    Addcmul = "ADDCMUL"
+    Addcdiv = "ADDCDIV"
+    Clamp = "CLAMP"
+
+    @property
+    def cpp_enum_value(self):
+        return f"ckernel::TernaryOp::{self.value}"
+
+
+class OptimizerType(Enum):
+    Adam = "ADAM"
+    AdamW = "ADAMW"
+    Lion = "LION"
+
+    @property
+    def cpp_enum_value(self):
+        return f"ckernel::OptimizerType::{self.value}"
+
+
 class MailboxesPerf(Enum):
     Unpacker = 0x1FFC4
     Math = 0x1FFC8
@@ -348,6 +427,7 @@ class MailboxesDebug(Enum):
 
 format_tile_sizes = {
     DataFormat.Bfp8_b: 1088,
+    DataFormat.Bfp4_b: 576,  # 64 exponents + 1024 4-bit mantissas
     DataFormat.Float16: 2048,
     DataFormat.Float16_b: 2048,
     DataFormat.Float32: 4096,
@@ -131,6 +131,62 @@ def pack_bfp8_b(tensor, block_size=16, num_faces=4, face_r_dim=16):
     return exponents + mantissas
 
 
+def float_to_bfp4_block(block):
+    """Quantise a block of 16 values to a shared exponent and 4-bit sign-magnitude mantissas.
+
+    A mantissa holds the sign and 3 magnitude bits m, so that a datum is m / 4 * 2^(exponent - 127).
+    Magnitudes are rounded to nearest and saturate at 7.
+    """
+    bits = np.asarray(block, dtype=np.float32).view(np.uint32)
+    signs = (bits >> 31).astype(np.int64)
+    exponents = ((bits >> 23) & 0xFF).astype(np.int64)
+    # 24-bit significand with the hidden bit, zero for zeros and denormals
+    significands = np.where(exponents > 0, (bits & 0x7FFFFF) | 0x800000, 0).astype(
+        np.int64
+    )
+
+    shared_exponent = int(exponents.max())
+    shifts = np.minimum(21 + shared_exponent - exponents, 62)
+    magnitudes = (significands + ((1 << shifts) >> 1)) >> shifts
+    magnitudes = np.minimum(magnitudes, 7)
+
+    return shared_exponent, ((signs << 3) | magnitudes).tolist()
+
+
+def pack_bfp4_b(tensor, block_size=16, num_faces=4, face_r_dim=16):
+    """Pack tensor into BFP4_b format.
+
+    Same layout as BFP8_b: all shared exponents first (at least MIN_BFP_EXPONENTS), then the
+    mantissas, two per byte with the first datum in the low nibble.
+    """
+    flattened_tensor = tensor.flatten()
+
+    elements_to_pack = face_r_dim * FACE_C_DIM * num_faces
+    assert (
+        len(flattened_tensor) >= elements_to_pack
+    ), f"Tensor has {len(flattened_tensor)} elements, but need at least {elements_to_pack} for {num_faces} face(s)"
+    values = flattened_tensor[:elements_to_pack].to(torch.float32).numpy()
+
+    exponents = []
+    mantissas = []
+
+    for i in range(len(values) // block_size):
+        shared_exponent, bfp4_mantissas = float_to_bfp4_block(
+            values[i * block_size : (i + 1) * block_size]
+        )
+        exponents.append(shared_exponent)
+        mantissas.extend(bfp4_mantissas)
+
+    if len(exponents) < MIN_BFP_EXPONENTS:
+        exponents.extend([0] * (MIN_BFP_EXPONENTS - len(exponents)))
+
+    packed_mantissas = [
+        mantissas[i] | (mantissas[i + 1] << 4) for i in range(0, len(mantissas), 2)
+    ]
+
+    return exponents + packed_mantissas
+
+
 # ============================================================================
 # MX (Microscaling) Format Support - OCP Specification
 # ============================================================================
@@ -0,0 +1,167 @@
+# SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Host-side generator for the SFPLUTFP32 piecewise tables of ckernel_sfpu_lut.h.
+
+The input is mapped onto the table axis with t = x * scale + offset and |t|
+picks one of six segments with breakpoints fixed by the table mode. Each
+segment is fitted to the target function by least squares, either as a line
+A * u + B or as the quadratic u * (A * u + B) + C with u = |t| and C shared by
+all segments. The domain is mapped so that its upper end falls one segment
+width past the last breakpoint; inputs beyond it extrapolate the last segment.
+"""
+
+import struct
+from dataclasses import dataclass
+from typing import Callable
+
+import torch
+
+from .llk_params import LutSymmetry
+
+# Inner breakpoints of |t| per SFPLUTFP32 6-entry FP16 table mode
+LUT_BREAKPOINTS = {
+    0: (0.5, 1.0, 1.5, 2.0, 4.0),
+    1: (0.5, 1.0, 1.5, 2.0, 3.0),
+}
+
+# The sigmoid and GELU tables encode 0 as 0x7C00, which the SFPU reads as zero
+FP16_ZERO = 0x7C00
+
+
+def _lut_end(lut_mode: int) -> float:
+    breakpoints = LUT_BREAKPOINTS[lut_mode]
+    return 2 * breakpoints[-1] - breakpoints[-2]
+
+
+def _fp16_bits(value: float) -> int:
+    half = torch.tensor(value, dtype=torch.float16)
+    if not torch.isfinite(half):
+        raise ValueError(f"LUT coefficient {value} does not fit in fp16")
+    if half == 0:
+        return FP16_ZERO
+    return half.view(torch.int16).item() & 0xFFFF
+
+
+def _fp32_bits(value: float) -> int:
+    return struct.unpack("<I", struct.pack("<f", value))[0]
+
+
+def _to_fp32(value: float) -> float:
+    return struct.unpack("<f", struct.pack("<f", value))[0]
+
+
+@dataclass
+class SfpuLut:
+    slopes: list[float]
+    intercepts: list[float]
+    scale: float
+    offset: float
+    constant: float
+    symmetry: LutSymmetry
+    quadratic: bool
+    lut_mode: int
+
+    def words(self) -> list[int]:
+        """SfpuLutTable words: A pairs, B pairs, then the fp32 scale, offset and C."""
+
+        def pairs(values):
+            bits = [_fp16_bits(value) for value in values]
+            return [bits[i] | (bits[i + 1] << 16) for i in range(0, 6, 2)]
+
+        return (
+            pairs(self.slopes)
+            + pairs(self.intercepts)
+            + [
+                _fp32_bits(self.scale),
+                _fp32_bits(self.offset),
+                _fp32_bits(self.constant),
+            ]
+        )
+
+    def evaluate(self, x: torch.Tensor) -> torch.Tensor:
+        """Emulates _calculate_lut_ in fp32."""
+        x = x.to(torch.float32)
+        t = x * self.scale + self.offset
+        if self.symmetry == LutSymmetry.Clamp:
+            t = t.clamp(min=0.0)
+        u = t.abs()
+
+        breakpoints = torch.tensor(LUT_BREAKPOINTS[self.lut_mode], dtype=torch.float32)
+        segment = torch.bucketize(u, breakpoints, right=True)
+        slopes = torch.tensor(self.slopes, dtype=torch.float32)[segment]
+        intercepts = torch.tensor(self.intercepts, dtype=torch.float32)[segment]
+        result = slopes * u + intercepts
+
+        if self.quadratic:
+            # The kernel multiplies by t; the parity of the table form makes up the sign
+            return result * u * self._sign(t) + self.constant
+        return result * self._sign(t)
+
+    def _sign(self, t: torch.Tensor) -> torch.Tensor:
+        if self.symmetry == LutSymmetry.Odd:
+            return torch.where(t < 0, -1.0, 1.0)
+        return torch.ones_like(t)
+
+
+def fit_lut(
+    function: Callable[[torch.Tensor], torch.Tensor],
+    lo: float,
+    hi: float,
+    symmetry: LutSymmetry = LutSymmetry.Clamp,
+    quadratic: bool = False,
+    lut_mode: int = 0,
+    samples: int = 256,
+) -> SfpuLut:
+    """
+    Fits a 6-segment SFPLUTFP32 table to function over [lo, hi].
+
+    Symmetric tables only cover [0, hi] and ignore lo. Inputs below lo of a
+    Clamp table take the value at lo, so a function that is flat there (e.g.
+    squared ReLU with lo = 0) needs no table segments for it.
+    """
+    lut_end = _lut_end(lut_mode)
+    if symmetry == LutSymmetry.Clamp:
+        scale = lut_end / (hi - lo)
+        offset = -lo * scale
+    else:
+        scale = lut_end / hi
+        offset = 0.0
+    # The kernel maps the input with the fp32 values
+    scale, offset = _to_fp32(scale), _to_fp32(offset)
+
+    def at(u: torch.Tensor) -> torch.Tensor:
+        return function((u - offset) / scale).to(torch.float64)
+
+    # All segments are fitted in one least-squares problem, so that a quadratic
+    # table can share its C; an odd quadratic has C = 0
+    shared_constant = quadratic and symmetry != LutSymmetry.Odd
+    edges = (0.0,) + LUT_BREAKPOINTS[lut_mode] + (lut_end,)
+    basis = torch.zeros(6 * samples, 12 + shared_constant, dtype=torch.float64)
+    target = torch.zeros(6 * samples, dtype=torch.float64)
+    for segment, (start, end) in enumerate(zip(edges[:-1], edges[1:])):
+        rows = slice(segment * samples, (segment + 1) * samples)
+        u = torch.linspace(start, end, samples, dtype=torch.float64)
+        # Quadratic segments fit u * (A * u + B), linear ones A * u + B
+        basis[rows, 2 * segment] = u * u if quadratic else u
+        basis[rows, 2 * segment + 1] = u if quadratic else 1.0
+        target[rows] = at(u)
+    if shared_constant:
+        basis[:, 12] = 1.0
+
+    solution = torch.linalg.lstsq(basis, target.unsqueeze(1)).solution.squeeze(1)
+    # Round now so that evaluate() matches the table the kernel sees
+    coefficients = solution[:12].to(torch.float16).tolist()
+    constant = solution[12].item() if shared_constant else 0.0
+
+    return SfpuLut(
+        slopes=coefficients[0::2],
+        intercepts=coefficients[1::2],
+        scale=scale,
+        offset=offset,
+        constant=_to_fp32(constant),
+        symmetry=symmetry,
+        quadratic=quadratic,
+        lut_mode=lut_mode,
+    )
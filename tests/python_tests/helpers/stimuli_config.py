@@ -14,6 +14,7 @@ from .format_config import DataFormat
 from .llk_params import format_tile_sizes
 from .logger import logger
 from .pack import (
+    pack_bfp4_b,
     pack_bfp8_b,
     pack_bfp16,
     pack_fp16,
@@ -219,6 +220,7 @@ class StimuliConfig:
             DataFormat.Float16_b: pack_bfp16,
             DataFormat.Float32: pack_fp32,
             DataFormat.Bfp8_b: pack_bfp8_b,
+            DataFormat.Bfp4_b: pack_bfp4_b,
             DataFormat.Int32: pack_int32,
             DataFormat.MxFp8R: pack_mxfp8r,
             DataFormat.MxFp8P: pack_mxfp8p,
@@ -259,7 +261,7 @@ class StimuliConfig:
 
         pack_function_lambda = lambda buffer_tile: (
             pack_function(buffer_tile, num_faces=num_faces, face_r_dim=face_r_dim)
-            if pack_function in [pack_bfp8_b, pack_mxfp8r, pack_mxfp8p]
+            if pack_function in [pack_bfp8_b, pack_bfp4_b, pack_mxfp8r, pack_mxfp8p]
             else pack_function(buffer_tile)
         )
 
@@ -299,7 +301,7 @@ class StimuliConfig:
 
         pack_function_lambda = lambda buffer_tile: (
             pack_function(buffer_tile, num_faces=num_faces, face_r_dim=face_r_dim)
-            if pack_function in [pack_bfp8_b, pack_mxfp8r, pack_mxfp8p]
+            if pack_function in [pack_bfp8_b, pack_bfp4_b, pack_mxfp8r, pack_mxfp8p]
             else pack_function(buffer_tile)
         )
 
@@ -4,11 +4,12 @@
 import torch
 
 from .format_config import (
+    MXFP8_BLOCK_SIZE,
     MXFP8_E4M3_MAX_NORMAL,
     MXFP8_E5M2_MAX_NORMAL,
     DataFormat,
 )
-from .llk_params import format_dict
+from .llk_params import MxFormat, format_dict
 from .tile_constants import (
     DEFAULT_TILE_C_DIM,
     DEFAULT_TILE_R_DIM,
@@ -119,6 +120,135 @@ def _generate_mxfp8_face(stimuli_format, size, const_face, const_value, sfpu):
     return face_data
 
 
+# MX float element formats:
+# (element width in bits, mantissa bits, exponent bias, largest value)
+MX_FLOAT_ELEMENTS = {
+    MxFormat.MxFp4: (4, 1, 1, 6.0),
+    MxFormat.MxFp6E2M3: (6, 3, 1, 7.5),
+    MxFormat.MxFp6E3M2: (6, 2, 3, 28.0),
+}
+# MXINT8 elements are two's complement with an implicit scale of 2^-6
+MXINT8_FRACTION_BITS = 6
+
+
+def encode_mx(tensor, mx_format: MxFormat):
+    """
+    Encode a tensor to an MX block format, as the Wormhole/Blackhole SFPU
+    dequantization (ckernel_sfpu_mx.h) reads it.
+
+    Every 32 consecutive elements form a block sharing an E8M0 scale, chosen per
+    the OCP MX spec so that the block maximum lands in the top binade of the
+    element format. Elements are rounded to nearest even, saturated to the largest
+    element value, and returned one per byte, MSB-aligned; pack_mx_elements packs
+    them for the SFPU.
+
+    Args:
+        tensor: Values to encode in L1 order, a multiple of 32 elements
+        mx_format: MX format to encode to
+
+    Returns:
+        (scales, elements): uint8 tensors, one scale per block, one byte per element
+    """
+    blocks = tensor.to(torch.float32).flatten().view(-1, MXFP8_BLOCK_SIZE)
+    if mx_format == MxFormat.MxInt8:
+        emax = 0
+    else:
+        emax = int(MX_FLOAT_ELEMENTS[mx_format][3]).bit_length() - 1
+
+    # amax = m * 2^e with m in [0.5, 1), so floor(log2(amax)) = e - 1
+    amax = blocks.abs().amax(dim=1, keepdim=True)
+    _, amax_exp = torch.frexp(amax)
+    shared_exp = torch.where(amax > 0, amax_exp - 1 - emax, 0).clamp(-127, 127)
+    scaled = blocks / torch.exp2(shared_exp.to(torch.float32))
+
+    if mx_format == MxFormat.MxInt8:
+        fixed = torch.round(scaled * 2**MXINT8_FRACTION_BITS).clamp(-128, 127)
+        elements = fixed.to(torch.int16) & 0xFF
+    else:
+        width, man_bits, bias, max_value = MX_FLOAT_ELEMENTS[mx_format]
+        mag = scaled.abs().clamp(max=max_value)
+        # Step between values around mag, subnormals share the smallest exponent
+        _, mag_exp = torch.frexp(mag)
+        exp = (mag_exp - 1).clamp(min=1 - bias)
+        significand = torch.round(mag / torch.exp2((exp - man_bits).to(torch.float32)))
+        # Rounding up to the next binade carries into the exponent field
+        exp_field = torch.where(
+            significand >= 2**man_bits, exp + bias, torch.zeros_like(exp)
+        )
+        carry = significand >= 2 ** (man_bits + 1)
+        exp_field = torch.where(carry, exp_field + 1, exp_field)
+        significand = torch.where(carry, significand / 2, significand)
+        man = significand.to(torch.int16) & (2**man_bits - 1)
+        code = (exp_field.to(torch.int16) << man_bits) | man
+        sign = (scaled < 0) & (code != 0)
+        code = code | (sign.to(torch.int16) << (width - 1))
+        elements = code << (8 - width)
+
+    scales = (shared_exp + 127).to(torch.uint8).flatten()
+    return scales, elements.to(torch.uint8).flatten()
+
+
+def _sfpu_row_index(row: int, lane: int) -> int:
+    """L1 index, within a 32x32 tile, of the datum lane holds in sfpi row row."""
+    pair, parity = divmod(row, 2)
+    face, group = divmod(pair, 4)
+    return face * 256 + (4 * group + lane // 8) * 16 + 2 * (lane % 8) + parity
+
+
+def pack_mx_elements(elements, mx_format: MxFormat):
+    """
+    Bit-pack the output of encode_mx into one UInt32 tile, as ckernel_sfpu_mx.h
+    reads it.
+
+    Each SFPU lane sees its words of the tile as one bit stream, word w being sfpi
+    row w. The element the lane holds in sfpi row r of MX tile t goes to bits
+    [(32 * t + r) * width, (32 * t + r + 1) * width) of the stream.
+
+    Returns:
+        The 1024 words of the tile in L1 order, as int64
+    """
+    width = 8 if mx_format == MxFormat.MxInt8 else MX_FLOAT_ELEMENTS[mx_format][0]
+    tiles = (elements.flatten().to(torch.int64) >> (8 - width)).view(-1, 32 * 32)
+    assert tiles.shape[0] * width <= 32, "MX tiles do not fit in one packed tile"
+
+    words = [0] * (32 * 32)
+    for tile, codes in enumerate(tiles.tolist()):
+        for row in range(32):
+            word, shift = divmod((32 * tile + row) * width, 32)
+            for lane in range(32):
+                bits = codes[_sfpu_row_index(row, lane)] << shift
+                words[_sfpu_row_index(word, lane)] |= bits & 0xFFFFFFFF
+                if bits >> 32:
+                    words[_sfpu_row_index(word + 1, lane)] |= bits >> 32
+    return torch.tensor(words, dtype=torch.int64)
+
+
+def decode_mx(scales, elements, mx_format: MxFormat):
+    """
+    Decode the output of encode_mx back to float32, the golden for SFPU dequantization.
+    """
+    elements = elements.flatten().to(torch.int16)
+    if mx_format == MxFormat.MxInt8:
+        fixed = torch.where(elements >= 0x80, elements - 0x100, elements)
+        values = fixed.to(torch.float32) * 2.0**-MXINT8_FRACTION_BITS
+    else:
+        width, man_bits, bias, _ = MX_FLOAT_ELEMENTS[mx_format]
+        code = elements >> (8 - width)
+        exp_field = (code >> man_bits) & (2 ** (width - 1 - man_bits) - 1)
+        man = (code & (2**man_bits - 1)).to(torch.float32)
+        subnormal = man * 2.0 ** (1 - bias - man_bits)
+        normal = (man + 2**man_bits) * torch.exp2(
+            (exp_field - bias - man_bits).to(torch.float32)
+        )
+        values = torch.where(exp_field == 0, subnormal, normal)
+        values = torch.where((code >> (width - 1)) != 0, -values, values)
+
+    scale = torch.exp2(scales.to(torch.float32) - 127).repeat_interleave(
+        MXFP8_BLOCK_SIZE
+    )
+    return values * scale
+
+
 def generate_identity_face_tensor(
     stimuli_format: DataFormat, rows: int, cols: int
 ) -> torch.Tensor:
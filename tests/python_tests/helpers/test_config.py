@@ -442,6 +442,7 @@ class TestConfig:
     def write_runtimes_to_L1(self, location: str = "0,0"):
         TILE_SIZES = {
             DataFormat.Bfp8_b: 68,
+            DataFormat.Bfp4_b: 36,
             DataFormat.Float32: 256,
         }
 
@@ -843,6 +844,7 @@ class TestConfig:
 
         TILE_SIZES = {
             DataFormat.Bfp8_b: 68,
+            DataFormat.Bfp4_b: 36,
             DataFormat.Float32: 256,
         }
 
@@ -3,6 +3,7 @@
 # SPDX-License-Identifier: Apache-2.0
 
 import math
+import struct
 from abc import ABC, abstractmethod
 from ctypes import c_uint32
 from dataclasses import dataclass
@@ -19,21 +20,29 @@ from .llk_params import (
     DestSync,
     EltwiseBinaryReuseDestType,
     FastMode,
+    Fp8Format,
     ImpliedMathFormat,
     L1Accumulation,
     MathFidelity,
     MathOperation,
+    MatmulReuse,
+    MxFormat,
     NarrowTile,
+    OptimizerType,
     PerfRunType,
     ReducePool,
+    RopeMode,
+    SfpuAccuracy,
     StableSort,
     StochasticRounding,
+    TernaryOp,
     Tilize,
     TopKSortDirection,
     Transpose,
     UnpackerEngine,
 )
 from .matmul_sweep import validate_tile_dimensions
+from .sfpu_lut import SfpuLut
 
 # Base parameter classes
 
@@ -84,6 +93,24 @@ class STOCHASTIC_ROUNDING(TemplateParameter):
         return f"constexpr auto STOCHASTIC_RND = ckernel::{self.stochastic_rounding.value};"
 
 
+@dataclass
+class PACK_STOCH_RND_RECONFIG(TemplateParameter):
+    # Set the pack rounding through _llk_pack_reconfig_data_format_, starting from the
+    # opposite rounding so that reconfiguring to No has to clear it
+    reconfig: bool = False
+
+    def covert_to_cpp(self) -> str:
+        return f"constexpr bool PACK_STOCH_RND_RECONFIG = {str(self.reconfig).lower()};"
+
+
+@dataclass
+class MATMUL_REUSE(TemplateParameter):
+    reuse: MatmulReuse = MatmulReuse.Auto
+
+    def covert_to_cpp(self) -> str:
+        return f"constexpr auto MATMUL_REUSE = ckernel::{self.reuse.value};"
+
+
 @dataclass
 class DATA_COPY_TYPE(TemplateParameter):
     data_copy_type: DataCopyType
@@ -322,6 +349,230 @@ class ADD_TOP_ROW(TemplateParameter):
         return f"constexpr bool ADD_TOP_ROW = {str(self.add_top_row).lower()};"
 
 
+@dataclass
+class ROPE_MODE(TemplateParameter):
+    rope_mode: RopeMode = RopeMode.Interleaved
+
+    def covert_to_cpp(self) -> str:
+        return f"constexpr auto ROPE_MODE = {self.rope_mode.cpp_enum_value};"
+
+
+@dataclass
+class SFPU_ACCURACY(TemplateParameter):
+    accuracy: SfpuAccuracy = SfpuAccuracy.Fp32
+
+    def covert_to_cpp(self) -> str:
+        return f"constexpr auto SFPU_ACCURACY = {self.accuracy.cpp_enum_value};"
+
+
+@dataclass
+class FP8_TYPECAST(TemplateParameter):
+    fp8_format: Fp8Format = Fp8Format.E4M3
+    encode: bool = True
+
+    def covert_to_cpp(self) -> str:
+        return "\n".join(
+            [
+                f"constexpr auto FP8_FORMAT = {self.fp8_format.cpp_enum_value};",
+                f"constexpr bool FP8_ENCODE = {str(self.encode).lower()};",
+            ]
+        )
+
+
+@dataclass
+class MX_FORMAT(TemplateParameter):
+    mx_format: MxFormat = MxFormat.MxFp4
+
+    def covert_to_cpp(self) -> str:
+        return f"constexpr auto MX_FORMAT = {self.mx_format.cpp_enum_value};"
+
+
+@dataclass
+class NLL(TemplateParameter):
+    nll_en: bool = False
+
+    def covert_to_cpp(self) -> str:
+        return f"constexpr bool NLL_EN = {str(self.nll_en).lower()};"
+
+
+@dataclass
+class SFPU_CHAIN(TemplateParameter):
+    # Chain run by sfpu_chain_test.cpp: Swish instead of Mish
+    swish: bool = False
+
+    def covert_to_cpp(self) -> str:
+        return f"constexpr bool SFPU_CHAIN_SWISH = {str(self.swish).lower()};"
+
+
+@dataclass
+class SOFTCAP(TemplateParameter):
+    softcap_en: bool = False
+    softcap: float = 0.0
+
+    def covert_to_cpp(self) -> str:
+        lines = [f"constexpr bool SOFTCAP_EN = {str(self.softcap_en).lower()};"]
+        if self.softcap_en:
+            lines.append(
+                f"constexpr float SOFTMAX_SOFTCAP = {float(self.softcap)!r}f;"
+            )
+        return "\n".join(lines)
+
+
+@dataclass
+class STOCHASTIC_ROUND_MAN_BITS(TemplateParameter):
+    man_bits: int = 7
+    # Exponent of the smallest normal of the target format
+    min_exp: int = -126
+
+    def covert_to_cpp(self) -> str:
+        return "\n".join(
+            [
+                f"constexpr int STOCHASTIC_ROUND_MAN_BITS = {self.man_bits};",
+                f"constexpr int STOCHASTIC_ROUND_MIN_EXP = {self.min_exp};",
+            ]
+        )
+
+
+@dataclass
+class SFPU_LUT(TemplateParameter):
+    table: SfpuLut = None
+
+    def covert_to_cpp(self) -> str:
+        words = ", ".join(f"0x{word:08X}" for word in self.table.words())
+        return "\n".join(
+            [
+                f"constexpr auto LUT_SYMMETRY = {self.table.symmetry.cpp_enum_value};",
+                f"constexpr bool LUT_QUADRATIC = {str(self.table.quadratic).lower()};",
+                f"constexpr int LUT_MODE = {self.table.lut_mode};",
+                f"constexpr std::array<std::uint32_t, 9> LUT_TABLE = {{{words}}};",
+            ]
+        )
+
+
+@dataclass
+class TERNARY_OP(TemplateParameter):
+    ternary_op: TernaryOp = TernaryOp.Fma
+
+    def covert_to_cpp(self) -> str:
+        return f"constexpr auto TERNARY_OP = {self.ternary_op.cpp_enum_value};"
+
+
+@dataclass
+class SFPU_OPTIMIZER(TemplateParameter):
+    optimizer: OptimizerType = OptimizerType.AdamW
+    lr: float = 1e-3
+    beta1: float = 0.9
+    beta2: float = 0.999
+    eps: float = 1e-8
+    weight_decay: float = 0.0
+    step: int = 1
+
+    def scalars(self) -> list[float]:
+        """SfpuOptimizerParams fields, with the step-dependent terms folded in."""
+        if self.optimizer == OptimizerType.Lion:
+            step_size, rsqrt_bias_correction2 = self.lr, 1.0
+        else:
+            step_size = self.lr / (1 - self.beta1**self.step)
+            rsqrt_bias_correction2 = 1 / math.sqrt(1 - self.beta2**self.step)
+        weight_decay = (
+            self.weight_decay
+            if self.optimizer == OptimizerType.Adam
+            else self.lr * self.weight_decay
+        )
+        return [
+            self.beta1,
+            self.beta2,
+            self.eps,
+            step_size,
+            rsqrt_bias_correction2,
+            weight_decay,
+        ]
+
+    def covert_to_cpp(self) -> str:
+        words = ", ".join(
+            f"0x{struct.unpack('<I', struct.pack('<f', value))[0]:08X}"
+            for value in self.scalars()
+        )
+        return "\n".join(
+            [
+                f"constexpr auto OPTIMIZER_TYPE = {self.optimizer.cpp_enum_value};",
+                f"constexpr std::array<std::uint32_t, 6> OPTIMIZER_PARAMS = {{{words}}};",
+            ]
+        )
+
+
+@dataclass
+class PACK_ROWS_INDICES(TemplateParameter):
+    indices: list[int] = None
+    rows_per_index: int = 1
+    scatter: bool = False
+    # Scatter onto the tile's own rows with L1 accumulation
+    scatter_add: bool = False
+
+    def covert_to_cpp(self) -> str:
+        words = ", ".join(str(index) for index in self.indices)
+        return "\n".join(
+            [
+                f"constexpr bool PACK_ROWS_SCATTER = {str(self.scatter).lower()};",
+                f"constexpr bool PACK_ROWS_SCATTER_ADD = {str(self.scatter_add).lower()};",
+                f"constexpr std::uint32_t PACK_ROWS_PER_INDEX = {self.rows_per_index};",
+                f"constexpr std::array<std::uint32_t, {len(self.indices)}> PACK_ROWS_INDICES = {{{words}}};",
+            ]
+        )
+
+
+@dataclass
+class PAGE_TABLE(TemplateParameter):
+    # Physical page slot of every logical page
+    page_order: list[int] = None
+    log2_tiles_per_page: int = 0
+
+    def covert_to_cpp(self) -> str:
+        words = ", ".join(str(slot) for slot in self.page_order)
+        return "\n".join(
+            [
+                f"constexpr std::uint32_t LOG2_TILES_PER_PAGE = {self.log2_tiles_per_page};",
+                f"constexpr std::array<std::uint32_t, {len(self.page_order)}> PAGE_ORDER = {{{words}}};",
+            ]
+        )
+
+
+@dataclass
+class SPARSE_FACE_MASKS(TemplateParameter):
+    # Bitmap of the stored faces of every tile
+    face_masks: list[int] = None
+    # Let the packer find the zero faces instead of passing the bitmaps
+    detect_zero_faces: bool = False
+
+    def covert_to_cpp(self) -> str:
+        words = ", ".join(str(mask) for mask in self.face_masks)
+        return "\n".join(
+            [
+                f"constexpr std::array<std::uint32_t, {len(self.face_masks)}> SPARSE_FACE_MASKS = {{{words}}};",
+                f"constexpr bool SPARSE_DETECT_ZERO_FACES = {str(self.detect_zero_faces).lower()};",
+            ]
+        )
+
+
+@dataclass
+class REQUANT(TemplateParameter):
+    relu: bool = False
+    unsigned_output: bool = False
+    sign_magnitude: bool = False
+    zero_point: float = 0.0
+
+    def covert_to_cpp(self) -> str:
+        zero_point = struct.unpack("<I", struct.pack("<f", self.zero_point))[0]
+        return "\n".join(
+            [
+                f"constexpr bool REQUANT_RELU = {str(self.relu).lower()};",
+                f"constexpr bool REQUANT_UNSIGNED_OUTPUT = {str(self.unsigned_output).lower()};",
+                f"constexpr bool SIGN_MAGNITUDE_FORMAT = {str(self.sign_magnitude).lower()};",
+                f"constexpr std::uint32_t REQUANT_ZERO_POINT = 0x{zero_point:08X};",
+            ]
+        )
+
+
 # === RUNTIME PARAMETER IMPLEMENTATIONS ===
 
 
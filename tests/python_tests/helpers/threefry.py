@@ -0,0 +1,54 @@
+# SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Host model of the Threefry-2x32 generator of ckernel_sfpu_random.h.
+
+The kernel hashes the counter (p * 32 + lane, tile_index) for each pair p of
+sfpi rows of a tile; word 0 feeds the even columns and word 1 the odd columns
+of the lane's position. threefry_tile() returns the words in tilized order.
+"""
+
+import torch
+
+MASK32 = 0xFFFFFFFF
+KEY_PARITY = 0x1BD11BDA
+ROTATIONS = (13, 15, 26, 6, 17, 29, 16, 24)
+
+
+def _rotl(x: int, r: int) -> int:
+    return ((x << r) | (x >> (32 - r))) & MASK32
+
+
+def threefry2x32(
+    counter: tuple[int, int], key: tuple[int, int], rounds: int = 20
+) -> tuple[int, int]:
+    """Threefry-2x32 as in Random123, with a key injection every 4 rounds."""
+    ks = (key[0], key[1], key[0] ^ key[1] ^ KEY_PARITY)
+    x0 = (counter[0] + ks[0]) & MASK32
+    x1 = (counter[1] + ks[1]) & MASK32
+    for r in range(rounds):
+        x0 = (x0 + x1) & MASK32
+        x1 = _rotl(x1, ROTATIONS[r % 8]) ^ x0
+        if r % 4 == 3:
+            s = r // 4 + 1
+            x0 = (x0 + ks[s % 3]) & MASK32
+            x1 = (x1 + ks[(s + 1) % 3] + s) & MASK32
+    return x0, x1
+
+
+def threefry_tile(
+    seed: int, stream: int, tile_index: int, rounds: int = 20
+) -> torch.Tensor:
+    """The 1024 random words the kernel draws for one tile, in tilized order."""
+    words = [0] * 1024
+    for pair in range(16):
+        face, group = divmod(pair, 4)
+        for lane in range(32):
+            x0, x1 = threefry2x32(
+                (pair * 32 + lane, tile_index), (seed, stream), rounds
+            )
+            row, column = 4 * group + lane // 8, 2 * (lane % 8)
+            index = face * 256 + row * 16 + column
+            words[index], words[index + 1] = x0, x1
+    return torch.tensor(words, dtype=torch.int64)
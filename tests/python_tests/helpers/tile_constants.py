@@ -172,6 +172,12 @@ def calculate_tile_size_bytes(data_format, tile_dimensions, format_tile_sizes):
         # mantissas = 1 byte per element
         return total_exponents + tile_elements
 
+    # BFP4_b has the same exponent section and two mantissas per byte
+    if data_format == DataFormat.Bfp4_b:
+        actual_exponents = tile_elements // 16
+        total_exponents = max(actual_exponents, MIN_BFP_EXPONENTS)
+        return total_exponents + tile_elements // 2
+
     # Use data_format.num_bytes_per_tile() for other formats
     # - MxFp8: 1 scale per 32 elements (at beginning of tile)
     # - Other formats: just element size * count
@@ -117,6 +117,25 @@ def unpack_bfp8_b(bfp8_block, sfpu=False, num_faces=4, face_r_dim=16):
     return torch.tensor(bfloat16_values, dtype=torch.bfloat16)
 
 
+def unpack_bfp4_b(bfp4_block, num_faces=4, face_r_dim=16):
+    """Unpack BFP4_b: shared exponents, then two 4-bit sign-magnitude mantissas per byte."""
+    actual_exponents = face_r_dim * num_faces
+    exponents_in_packed = max(actual_exponents, MIN_BFP_EXPONENTS)
+
+    exponents = np.array(bfp4_block[:actual_exponents], dtype=np.int64)
+    packed = np.array(
+        bfp4_block[exponents_in_packed : exponents_in_packed + actual_exponents * 8],
+        dtype=np.uint8,
+    )
+
+    nibbles = np.stack((packed & 0xF, packed >> 4), axis=1).flatten()
+    signs = np.where(nibbles & 0x8, -1.0, 1.0)
+    magnitudes = (nibbles & 0x7).astype(np.float64) / 4
+    scales = np.exp2(np.repeat(exponents, 16) - 127.0)
+
+    return torch.tensor(signs * magnitudes * scales, dtype=torch.bfloat16)
+
+
 # ============================================================================
 # MX (Microscaling) Format Support - OCP Specification
 # ============================================================================
@@ -239,6 +258,8 @@ def unpack_res_tiles(
 
     if output_format == DataFormat.Bfp8_b:
         unpack_func = unpack_bfp16 if sfpu else unpack_bfp8_b
+    elif output_format == DataFormat.Bfp4_b:
+        unpack_func = unpack_bfp4_b
     elif output_format == DataFormat.MxFp8R:
         unpack_func = unpack_mxfp8r
     elif output_format == DataFormat.MxFp8P:
@@ -258,6 +279,10 @@ def unpack_res_tiles(
             unpacked_tile = unpack_func(
                 tile_data, sfpu=sfpu, num_faces=num_faces, face_r_dim=face_r_dim
             )
+        elif unpack_func == unpack_bfp4_b:
+            unpacked_tile = unpack_func(
+                tile_data, num_faces=num_faces, face_r_dim=face_r_dim
+            )
         elif unpack_func in [unpack_mxfp8r, unpack_mxfp8p]:
             unpacked_tile = unpack_func(tile_data, num_faces=num_faces)
         else:
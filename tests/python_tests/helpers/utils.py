@@ -169,6 +169,7 @@ def passed_test(
             DataFormat.Int8: Tolerance(atol=0, rtol=0),
             DataFormat.UInt8: Tolerance(atol=0, rtol=0),
             DataFormat.Bfp8_b: Tolerance(atol=0.1, rtol=0.2),
+            DataFormat.Bfp4_b: Tolerance(atol=0.1, rtol=0.2),
             DataFormat.MxFp8R: Tolerance(atol=0.2, rtol=0.3),
             DataFormat.MxFp8P: Tolerance(atol=0.2, rtol=0.3),
         }
@@ -0,0 +1,71 @@
+# SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import torch
+from helpers.format_config import DataFormat, InputOutputFormat
+from helpers.golden_generators import DataCopyGolden, get_golden_generator
+from helpers.llk_params import DestAccumulation, format_dict
+from helpers.param_config import parametrize
+from helpers.stimuli_config import StimuliConfig
+from helpers.stimuli_generator import generate_stimuli
+from helpers.test_config import TestConfig
+from helpers.test_variant_parameters import NUM_FACES, TILE_COUNT
+from helpers.utils import passed_test
+
+# The unpacker writes 32-bit tiles straight to dest and the packer does the conversion
+CONVERT_TILES_FORMATS = [
+    InputOutputFormat(DataFormat.Float32, DataFormat.Float32),
+    InputOutputFormat(DataFormat.Float32, DataFormat.Float16_b),
+    InputOutputFormat(DataFormat.Float32, DataFormat.Float16),
+    InputOutputFormat(DataFormat.Float32, DataFormat.Bfp8_b),
+    InputOutputFormat(DataFormat.Int32, DataFormat.Int32),
+]
+
+
+@parametrize(formats=CONVERT_TILES_FORMATS)
+def test_convert_tiles(formats, workers_tensix_coordinates):
+    # Four 32-bit tiles fill a half of dest
+    input_dimensions = [64, 64]
+
+    src_A, tile_cnt_A, src_B, tile_cnt_B = generate_stimuli(
+        stimuli_format_A=formats.input_format,
+        input_dimensions_A=input_dimensions,
+        stimuli_format_B=formats.input_format,
+        input_dimensions_B=input_dimensions,
+    )
+
+    generate_golden = get_golden_generator(DataCopyGolden)
+    golden_tensor = generate_golden(
+        src_A, formats.output_format, num_faces=4, input_dimensions=input_dimensions
+    )
+
+    configuration = TestConfig(
+        "sources/convert_tiles_test.cpp",
+        formats,
+        templates=[],
+        runtimes=[TILE_COUNT(tile_cnt_A), NUM_FACES()],
+        variant_stimuli=StimuliConfig(
+            src_A,
+            formats.input_format,
+            src_B,
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=tile_cnt_A,
+            tile_count_B=tile_cnt_B,
+            tile_count_res=tile_cnt_A,
+        ),
+        dest_acc=DestAccumulation.Yes,
+        unpack_to_dest=True,
+    )
+
+    res_from_L1 = configuration.run(workers_tensix_coordinates).result
+
+    assert len(res_from_L1) == len(
+        golden_tensor
+    ), "Result tensor and golden tensor are not of the same length"
+
+    res_tensor = torch.tensor(res_from_L1, dtype=format_dict[formats.output_format])
+
+    assert passed_test(
+        golden_tensor, res_tensor, formats.output_format
+    ), "Assert against golden failed"
@@ -7,7 +7,12 @@ import torch
 from helpers.device import BootMode
 from helpers.format_config import DataFormat, FormatConfig, is_dest_acc_needed
 from helpers.golden_generators import MatmulGolden, get_golden_generator
-from helpers.llk_params import DestAccumulation, MathFidelity, format_dict
+from helpers.llk_params import (
+    DestAccumulation,
+    MathFidelity,
+    MatmulReuse,
+    format_dict,
+)
 from helpers.matmul_sweep import (
     generate_matmul_dimension_combinations,
     generate_tile_dims,
@@ -19,6 +24,7 @@ from helpers.test_config import TestConfig
 from helpers.test_variant_parameters import (
     CRK_TILE_DIMM,
     MATH_FIDELITY,
+    MATMUL_REUSE,
     NUM_FACES,
     TILE_COUNT,
 )
@@ -129,7 +135,7 @@ def test_matmul(
     configuration = TestConfig(
         "sources/matmul_test.cpp",
         formats,
-        templates=[MATH_FIDELITY(math_fidelity)],
+        templates=[MATH_FIDELITY(math_fidelity), MATMUL_REUSE()],
         runtimes=[
             NUM_FACES(),
             TILE_COUNT(matmul_dims.output_tile_cnt),
@@ -160,3 +166,76 @@ def test_matmul(
     assert passed_test(
         golden_tensor, res_tensor, formats.output_format
     ), "Assert against golden failed"
+
+
+@parametrize(
+    formats=input_output_formats([DataFormat.Float16_b], same=True),
+    reuse=[MatmulReuse.Auto, MatmulReuse.In0, MatmulReuse.In1],
+    # ct_dim > rt_dim, rt_dim > ct_dim and square; Auto reuses input 0 unless
+    # rt_dim > ct_dim
+    dimensions=[
+        ([32, 64], [64, 96]),
+        ([96, 64], [64, 32]),
+        ([64, 64], [64, 64]),
+    ],
+)
+def test_matmul_reuse(formats, reuse, dimensions, workers_tensix_coordinates):
+    input_A_dimensions, input_B_dimensions = dimensions
+
+    src_A, tile_cnt_A, src_B, tile_cnt_B = generate_stimuli(
+        stimuli_format_A=formats.input_format,
+        input_dimensions_A=input_A_dimensions,
+        stimuli_format_B=formats.input_format,
+        input_dimensions_B=input_B_dimensions,
+        sfpu=False,
+    )
+    matmul_dims = generate_tile_dims((input_A_dimensions, input_B_dimensions))
+
+    generate_golden = get_golden_generator(MatmulGolden)
+    golden_tensor = generate_golden(
+        src_A,
+        src_B,
+        formats.output_format,
+        MathFidelity.HiFi4,
+        input_A_dimensions=input_A_dimensions,
+        input_B_dimensions=input_B_dimensions,
+        tilize=True,
+    )
+
+    tilized_A = tilize_block(
+        src_A, dimensions=input_A_dimensions, stimuli_format=formats.input_format
+    )
+    tilized_B = tilize_block(
+        src_B, dimensions=input_B_dimensions, stimuli_format=formats.input_format
+    )
+
+    configuration = TestConfig(
+        "sources/matmul_test.cpp",
+        formats,
+        templates=[MATH_FIDELITY(MathFidelity.HiFi4), MATMUL_REUSE(reuse)],
+        runtimes=[
+            NUM_FACES(),
+            TILE_COUNT(matmul_dims.output_tile_cnt),
+            CRK_TILE_DIMM(matmul_dims.ct_dim, matmul_dims.rt_dim, matmul_dims.kt_dim),
+        ],
+        variant_stimuli=StimuliConfig(
+            tilized_A.flatten(),
+            formats.input_format,
+            tilized_B.flatten(),
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=tile_cnt_A,
+            tile_count_B=tile_cnt_B,
+            tile_count_res=matmul_dims.output_tile_cnt,
+        ),
+        dest_acc=DestAccumulation.No,
+    )
+
+    res_from_L1 = configuration.run(workers_tensix_coordinates).result
+    assert len(res_from_L1) == len(golden_tensor)
+    res_tensor = torch.tensor(res_from_L1, dtype=format_dict[formats.output_format])
+
+    # Forcing either input to be reused gives the same result as the Auto heuristic
+    assert passed_test(
+        golden_tensor, res_tensor, formats.output_format
+    ), "Assert against golden failed"
@@ -0,0 +1,153 @@
+# SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import torch
+from helpers.format_config import DataFormat
+from helpers.llk_params import DestAccumulation, format_dict
+from helpers.param_config import input_output_formats, parametrize
+from helpers.stimuli_config import StimuliConfig
+from helpers.stimuli_generator import generate_stimuli
+from helpers.test_config import TestConfig
+from helpers.test_variant_parameters import (
+    PACK_ROWS_INDICES,
+    TILE_COUNT,
+    generate_input_dim,
+)
+from helpers.utils import passed_test
+
+# A dest tile in row-major layout is 64 rows of 16 datums
+ROWS_PER_TILE = 64
+ROW_NUM_DATUMS = 16
+
+
+@parametrize(
+    formats=input_output_formats(
+        [DataFormat.Float16_b, DataFormat.Float32, DataFormat.Int32],
+        same=True,
+    ),
+    dest_acc=[DestAccumulation.No, DestAccumulation.Yes],
+    rows_per_index=[1, 2, 4],
+    scatter=[False, True],
+)
+def test_pack_rows_indexed(
+    formats, dest_acc, rows_per_index, scatter, workers_tensix_coordinates
+):
+    dimensions = [32, 32]
+
+    src_A, tile_cnt_A, src_B, tile_cnt_B = generate_stimuli(
+        stimuli_format_A=formats.input_format,
+        input_dimensions_A=dimensions,
+        stimuli_format_B=formats.input_format,
+        input_dimensions_B=dimensions,
+    )
+
+    num_units = ROWS_PER_TILE // rows_per_index
+    torch.manual_seed(0)
+    if scatter:
+        # A permutation, so that every output row is written
+        indices = torch.randperm(num_units)
+    else:
+        # Repeats and gaps, as in an embedding lookup
+        indices = torch.randint(0, num_units, (num_units // 2 + 3,))
+
+    units = src_A.flatten()[: ROWS_PER_TILE * ROW_NUM_DATUMS].view(num_units, -1)
+    if scatter:
+        golden_units = torch.empty_like(units)
+        golden_units[indices] = units
+    else:
+        golden_units = units[indices]
+    golden_tensor = golden_units.flatten().to(format_dict[formats.output_format])
+
+    configuration = TestConfig(
+        "sources/pack_rows_indexed_test.cpp",
+        formats,
+        templates=[
+            generate_input_dim(dimensions, dimensions),
+            PACK_ROWS_INDICES(indices.tolist(), rows_per_index, scatter),
+        ],
+        runtimes=[TILE_COUNT(tile_cnt_A)],
+        variant_stimuli=StimuliConfig(
+            src_A,
+            formats.input_format,
+            src_B,
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=tile_cnt_A,
+            tile_count_B=tile_cnt_B,
+            tile_count_res=tile_cnt_A,
+        ),
+        dest_acc=dest_acc,
+        unpack_to_dest=formats.input_format.is_32_bit(),
+    )
+
+    res_from_L1 = configuration.run(workers_tensix_coordinates).result
+
+    res_tensor = torch.tensor(res_from_L1, dtype=format_dict[formats.output_format])
+    res_tensor = res_tensor[: len(golden_tensor)]
+
+    assert len(res_tensor) == len(golden_tensor)
+
+    assert passed_test(golden_tensor, res_tensor, formats.output_format)
+
+
+@parametrize(
+    formats=input_output_formats(
+        [DataFormat.Float16_b, DataFormat.Float32],
+        same=True,
+    ),
+    rows_per_index=[1, 2, 4],
+)
+def test_pack_rows_scatter_add(formats, rows_per_index, workers_tensix_coordinates):
+    dimensions = [32, 32]
+    dest_acc = (
+        DestAccumulation.Yes
+        if formats.input_format.is_32_bit()
+        else DestAccumulation.No
+    )
+
+    src_A, tile_cnt_A, src_B, tile_cnt_B = generate_stimuli(
+        stimuli_format_A=formats.input_format,
+        input_dimensions_A=dimensions,
+        stimuli_format_B=formats.input_format,
+        input_dimensions_B=dimensions,
+    )
+
+    num_units = ROWS_PER_TILE // rows_per_index
+    torch.manual_seed(0)
+    # More indices than distinct values, so some rows are accumulated into repeatedly.
+    # The scatter expects repeated indices to be adjacent
+    indices, _ = torch.sort(torch.randint(0, num_units // 2, (num_units // 2 + 3,)))
+
+    units = src_A.flatten()[: ROWS_PER_TILE * ROW_NUM_DATUMS].view(num_units, -1)
+    golden_units = units.to(torch.float32).clone()
+    golden_units.index_add_(0, indices, units[: len(indices)].to(torch.float32))
+    golden_tensor = golden_units.flatten().to(format_dict[formats.output_format])
+
+    configuration = TestConfig(
+        "sources/pack_rows_indexed_test.cpp",
+        formats,
+        templates=[
+            generate_input_dim(dimensions, dimensions),
+            PACK_ROWS_INDICES(indices.tolist(), rows_per_index, scatter_add=True),
+        ],
+        runtimes=[TILE_COUNT(tile_cnt_A)],
+        variant_stimuli=StimuliConfig(
+            src_A,
+            formats.input_format,
+            src_B,
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=tile_cnt_A,
+            tile_count_B=tile_cnt_B,
+            tile_count_res=tile_cnt_A,
+        ),
+        dest_acc=dest_acc,
+        unpack_to_dest=formats.input_format.is_32_bit(),
+    )
+
+    res_from_L1 = configuration.run(workers_tensix_coordinates).result
+
+    res_tensor = torch.tensor(res_from_L1, dtype=format_dict[formats.output_format])
+    res_tensor = res_tensor[: len(golden_tensor)]
+
+    assert passed_test(golden_tensor, res_tensor, formats.output_format)
@@ -0,0 +1,78 @@
+# SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import torch
+from helpers.format_config import DataFormat, InputOutputFormat
+from helpers.llk_params import DestAccumulation, StochasticRounding
+from helpers.param_config import parametrize
+from helpers.stimuli_config import StimuliConfig
+from helpers.test_config import TestConfig
+from helpers.test_variant_parameters import (
+    PACK_STOCH_RND_RECONFIG,
+    STOCHASTIC_ROUNDING,
+    TILE_COUNT,
+)
+
+TILE_CNT = 4
+NUM_DATUMS = TILE_CNT * 32 * 32
+
+# Ulp at 1.0 of each output format (Bfp8_b keeps 6 fraction bits)
+PACK_ULP = {
+    DataFormat.Float16_b: 2.0**-7,
+    DataFormat.Bfp8_b: 2.0**-6,
+}
+
+
+@parametrize(
+    formats=[
+        InputOutputFormat(DataFormat.Float32, DataFormat.Float16_b),
+        InputOutputFormat(DataFormat.Float32, DataFormat.Bfp8_b),
+    ],
+    stochastic_rounding=[StochasticRounding.No, StochasticRounding.Pack],
+    reconfig=[False, True],
+)
+def test_pack_stoch_rnd(
+    formats, stochastic_rounding, reconfig, workers_tensix_coordinates
+):
+    ulp = PACK_ULP[formats.output_format]
+    # A quarter of an ulp above 1.0
+    value = 1.0 + ulp / 4
+    src = torch.full((NUM_DATUMS,), value, dtype=torch.float32)
+
+    configuration = TestConfig(
+        "sources/pack_stoch_rnd_test.cpp",
+        formats,
+        templates=[
+            STOCHASTIC_ROUNDING(stochastic_rounding),
+            PACK_STOCH_RND_RECONFIG(reconfig),
+        ],
+        runtimes=[TILE_COUNT(TILE_CNT)],
+        variant_stimuli=StimuliConfig(
+            src,
+            formats.input_format,
+            src,
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=TILE_CNT,
+            tile_count_B=TILE_CNT,
+            tile_count_res=TILE_CNT,
+        ),
+        unpack_to_dest=True,
+        dest_acc=DestAccumulation.Yes,
+    )
+
+    res_from_L1 = configuration.run(workers_tensix_coordinates).result[:NUM_DATUMS]
+    res_tensor = torch.tensor(res_from_L1, dtype=torch.float32)
+
+    rounded_up = res_tensor == 1.0 + ulp
+    assert torch.all(
+        rounded_up | (res_tensor == 1.0)
+    ), "Results must be one of the two neighbours"
+
+    fraction_up = rounded_up.to(torch.float32).mean().item()
+    if stochastic_rounding == StochasticRounding.No:
+        # Round to nearest even
+        assert fraction_up == 0.0
+    else:
+        # Rounds up a quarter of the time, so the mean is unbiased
+        assert 0.15 < fraction_up < 0.35, f"Rounded up {fraction_up} of the time"
@@ -0,0 +1,99 @@
+# SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import torch
+from helpers.format_config import DataFormat
+from helpers.golden_generators import (
+    DataCopyGolden,
+    TransposeGolden,
+    get_golden_generator,
+)
+from helpers.llk_params import DestAccumulation, format_dict
+from helpers.param_config import input_output_formats, parametrize
+from helpers.stimuli_config import StimuliConfig
+from helpers.stimuli_generator import generate_stimuli
+from helpers.test_config import TestConfig, TestMode
+from helpers.test_variant_parameters import NUM_FACES, TILE_COUNT
+from helpers.utils import passed_test
+
+# Math transposes within faces and the packer transposes the faces, which together
+# transpose every tile. 32-bit float dest is left out for the same bit No.11 issue as
+# in test_transpose_dest.
+PACK_TRANSPOSE_FORMATS = [
+    (fmt, DestAccumulation.No, False)
+    for fmt in input_output_formats(
+        [DataFormat.Float16, DataFormat.Float16_b, DataFormat.Bfp8_b], same=True
+    )
+] + [
+    (fmt, DestAccumulation.Yes, True)
+    for fmt in input_output_formats([DataFormat.Int32], same=True)
+]
+
+
+@parametrize(fmt_dest_acc_unpack_to_dest=PACK_TRANSPOSE_FORMATS)
+def test_pack_transpose_faces(fmt_dest_acc_unpack_to_dest, workers_tensix_coordinates):
+    formats, dest_acc, unpack_to_dest = fmt_dest_acc_unpack_to_dest[0]
+
+    input_dimensions = [64, 64]
+
+    src_A, tile_cnt_A, src_B, tile_cnt_B = generate_stimuli(
+        stimuli_format_A=formats.input_format,
+        input_dimensions_A=input_dimensions,
+        stimuli_format_B=formats.input_format,
+        input_dimensions_B=input_dimensions,
+    )
+
+    generate_datacopy_golden = get_golden_generator(DataCopyGolden)
+    datacopy_tensor = generate_datacopy_golden(
+        src_A, formats.output_format, num_faces=4, input_dimensions=input_dimensions
+    )
+
+    if TestConfig.MODE != TestMode.PRODUCE:
+        t_matrix = get_golden_generator(TransposeGolden)
+        golden_tensor = t_matrix.transpose_faces_multi_tile(
+            datacopy_tensor,
+            formats.output_format,
+            num_tiles=tile_cnt_A,
+            tilize=False,
+            input_dimensions=input_dimensions,
+        )
+        golden_tensor = t_matrix.transpose_within_faces_multi_tile(
+            golden_tensor,
+            formats.output_format,
+            num_tiles=tile_cnt_A,
+            untilize=False,
+            input_dimensions=input_dimensions,
+        )
+    else:
+        golden_tensor = []
+
+    configuration = TestConfig(
+        "sources/pack_transpose_faces_test.cpp",
+        formats,
+        templates=[],
+        runtimes=[TILE_COUNT(tile_cnt_A), NUM_FACES()],
+        variant_stimuli=StimuliConfig(
+            src_A,
+            formats.input_format,
+            src_B,
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=tile_cnt_A,
+            tile_count_B=tile_cnt_B,
+            tile_count_res=tile_cnt_A,
+        ),
+        dest_acc=dest_acc,
+        unpack_to_dest=unpack_to_dest,
+    )
+
+    res_from_L1 = configuration.run(workers_tensix_coordinates).result
+
+    assert len(res_from_L1) == len(
+        golden_tensor
+    ), "Result tensor and golden tensor are not of the same length"
+
+    res_tensor = torch.tensor(res_from_L1, dtype=format_dict[formats.output_format])
+
+    assert passed_test(
+        golden_tensor, res_tensor, formats.output_format
+    ), "Assert against golden failed"
@@ -0,0 +1,97 @@
+# SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import torch
+from helpers.constraints import get_valid_dest_accumulation_modes
+from helpers.format_config import DataFormat
+from helpers.golden_generators import UntilizeGolden, get_golden_generator
+from helpers.llk_params import DestAccumulation, DestSync, format_dict
+from helpers.param_config import (
+    input_output_formats,
+    parametrize,
+)
+from helpers.stimuli_config import StimuliConfig
+from helpers.stimuli_generator import generate_stimuli
+from helpers.test_config import TestConfig
+from helpers.test_variant_parameters import (
+    DEST_SYNC,
+    NUM_FACES,
+    TILE_COUNT,
+    generate_input_dim,
+)
+from helpers.utils import passed_test
+
+
+@parametrize(
+    formats=input_output_formats(
+        [
+            DataFormat.Float16_b,
+            DataFormat.Float32,
+        ],
+        same=True,
+    ),
+    dest_acc=lambda formats: get_valid_dest_accumulation_modes(formats),
+    # Widths that are not a multiple of the block, so that the last block of every row is narrower
+    input_dimensions=[[32, 352], [64, 160], [32, 1216], [32, 96]],
+    dest_sync=[DestSync.Half],
+)
+def test_pack_untilize_stream(
+    formats, dest_acc, input_dimensions, dest_sync, workers_tensix_coordinates
+):
+    src_A, tile_cnt_A, src_B, tile_cnt_B = generate_stimuli(
+        stimuli_format_A=formats.input_format,
+        input_dimensions_A=input_dimensions,
+        stimuli_format_B=formats.input_format,
+        input_dimensions_B=input_dimensions,
+        sfpu=False,
+    )
+
+    generate_golden = get_golden_generator(UntilizeGolden)
+
+    golden_tensor = generate_golden(src_A, formats.output_format, input_dimensions)
+
+    unpack_to_dest = (
+        formats.input_format.is_32_bit() and dest_acc == DestAccumulation.Yes
+    )
+
+    # Largest block that fits a half of dest; full_ct_dim no longer needs to be a multiple of it
+    block_ct_dim = 8 if dest_acc == DestAccumulation.No else 4
+
+    configuration = TestConfig(
+        "sources/pack_untilize_stream_test.cpp",
+        formats,
+        templates=[
+            generate_input_dim(
+                input_dimensions,
+                input_dimensions,
+                block_ct_dim,
+            ),
+            DEST_SYNC(dest_sync),
+        ],
+        runtimes=[TILE_COUNT(tile_cnt_A), NUM_FACES(4)],
+        variant_stimuli=StimuliConfig(
+            src_A,
+            formats.input_format,
+            src_B,
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=tile_cnt_A,
+            tile_count_B=tile_cnt_B,
+            tile_count_res=tile_cnt_A,
+            sfpu=False,
+        ),
+        dest_acc=dest_acc,
+        unpack_to_dest=unpack_to_dest,
+    )
+
+    res_from_L1 = configuration.run(workers_tensix_coordinates).result
+
+    assert len(res_from_L1) == len(
+        golden_tensor
+    ), "Result tensor and golden tensor are not of the same length"
+
+    res_tensor = torch.tensor(res_from_L1, dtype=format_dict[formats.output_format])
+
+    assert passed_test(
+        golden_tensor, res_tensor, formats.output_format
+    ), "Assert against golden failed"
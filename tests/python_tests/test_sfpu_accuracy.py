@@ -0,0 +1,176 @@
+# SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import csv
+
+import pytest
+import torch
+from helpers.format_config import DataFormat
+from helpers.llk_params import (
+    DestAccumulation,
+    MathOperation,
+    SfpuAccuracy,
+    format_dict,
+)
+from helpers.logger import logger
+from helpers.param_config import input_output_formats, parametrize
+from helpers.stimuli_config import StimuliConfig
+from helpers.test_config import TestConfig
+from helpers.test_variant_parameters import MATH_OP, SFPU_ACCURACY
+from helpers.tilize_untilize import tilize
+from helpers.utils import passed_test
+
+# Input domain and float64 reference per op
+OPERATIONS = {
+    MathOperation.Exp: ((-20.0, 20.0), torch.exp),
+    MathOperation.Reciprocal: ((0.01, 100.0), torch.reciprocal),
+    MathOperation.Sqrt: ((0.0, 100.0), torch.sqrt),
+    MathOperation.Rsqrt: ((0.01, 100.0), torch.rsqrt),
+    MathOperation.Tanh: ((-6.0, 6.0), torch.tanh),
+    MathOperation.Sigmoid: ((-20.0, 20.0), torch.sigmoid),
+    MathOperation.Silu: ((-20.0, 20.0), torch.nn.functional.silu),
+    MathOperation.Elu: ((-20.0, 6.0), torch.nn.functional.elu),
+    MathOperation.Gelu: ((-6.0, 6.0), torch.nn.functional.gelu),
+}
+
+# Max error in ulp of the output format per tier; ops absent from a tier are only
+# reported and checked against the default golden tolerance
+ULP_BOUNDS = {
+    SfpuAccuracy.Fp32: {
+        MathOperation.Exp: 2,
+        MathOperation.Reciprocal: 2,
+        MathOperation.Sqrt: 2,
+        MathOperation.Rsqrt: 2,
+        MathOperation.Tanh: 6,
+        MathOperation.Sigmoid: 4,
+        MathOperation.Silu: 5,
+        MathOperation.Elu: 4,
+    },
+    SfpuAccuracy.Bf16: {
+        MathOperation.Exp: 1,
+        MathOperation.Reciprocal: 1,
+        MathOperation.Sqrt: 1,
+        MathOperation.Rsqrt: 1,
+        MathOperation.Tanh: 1,
+        MathOperation.Sigmoid: 1,
+        MathOperation.Silu: 1,
+        MathOperation.Elu: 1,
+    },
+    SfpuAccuracy.FastApprox: {},
+}
+
+MANTISSA_BITS = {DataFormat.Float32: 23, DataFormat.Float16_b: 7}
+
+
+def ulp_error(result: torch.Tensor, golden: torch.Tensor, data_format: DataFormat):
+    golden = golden.to(torch.float64)
+    smallest_normal = torch.finfo(torch.float32).tiny
+    exponent = torch.floor(torch.log2(golden.abs().clamp(min=smallest_normal)))
+    ulp = torch.exp2(exponent - MANTISSA_BITS[data_format])
+    error = (result.to(torch.float64) - golden).abs() / ulp
+    # Saturated results match when both sides are the same infinity
+    return torch.where(
+        result.to(torch.float64) == golden, torch.zeros_like(error), error
+    )
+
+
+@pytest.fixture(scope="module")
+def accuracy_report():
+    rows = []
+    yield rows
+
+    if not rows:
+        return
+
+    report_path = TestConfig.ARTEFACTS_DIR / "sfpu_accuracy_report.csv"
+    report_path.parent.mkdir(parents=True, exist_ok=True)
+    with open(report_path, "w", newline="") as report_file:
+        writer = csv.DictWriter(report_file, fieldnames=rows[0].keys())
+        writer.writeheader()
+        writer.writerows(rows)
+
+    logger.info("SFPU accuracy report written to {}", report_path)
+    for row in rows:
+        logger.info(
+            "{op:>12} {tier:>10} {format:>10}: "
+            "max {max_ulp:.2f} ulp, mean {mean_ulp:.3f} ulp",
+            **row,
+        )
+
+
+@parametrize(
+    formats=input_output_formats(
+        [DataFormat.Float16_b, DataFormat.Float32],
+        same=True,
+    ),
+    mathop=list(OPERATIONS.keys()),
+    accuracy=[SfpuAccuracy.Fp32, SfpuAccuracy.Bf16, SfpuAccuracy.FastApprox],
+)
+def test_sfpu_accuracy(
+    formats, mathop, accuracy, accuracy_report, workers_tensix_coordinates
+):
+    # Fp32 is judged on a 32-bit dest and output, the other tiers at bf16
+    is_fp32_output = formats.output_format == DataFormat.Float32
+    if (accuracy == SfpuAccuracy.Fp32) != is_fp32_output:
+        pytest.skip("Tier is measured in its own output format")
+
+    torch.manual_seed(0)
+    (lo, hi), reference = OPERATIONS[mathop]
+    torch_format = format_dict[formats.input_format]
+
+    src = torch.rand(32 * 32, dtype=torch.float64) * (hi - lo) + lo
+    src = src.to(torch_format)
+    src_tilized = tilize(src, formats.input_format)
+    # Elementwise, so the float64 golden is computed directly in tile order
+    golden_tensor = reference(src_tilized.to(torch.float64))
+
+    configuration = TestConfig(
+        "sources/sfpu_accuracy_test.cpp",
+        formats,
+        templates=[MATH_OP(mathop=mathop), SFPU_ACCURACY(accuracy)],
+        runtimes=[],
+        variant_stimuli=StimuliConfig(
+            src_tilized,
+            formats.input_format,
+            src,
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=1,
+            tile_count_B=1,
+            tile_count_res=1,
+        ),
+        unpack_to_dest=formats.input_format.is_32_bit(),
+        dest_acc=(
+            DestAccumulation.Yes
+            if formats.input_format.is_32_bit()
+            else DestAccumulation.No
+        ),
+    )
+
+    res_from_L1 = configuration.run(workers_tensix_coordinates).result[:1024]
+    res_tensor = torch.tensor(res_from_L1, dtype=format_dict[formats.output_format])
+
+    errors = ulp_error(res_tensor, golden_tensor, formats.output_format)
+
+    accuracy_report.append(
+        {
+            "op": mathop.name,
+            "tier": accuracy.name,
+            "format": formats.output_format.name,
+            "max_ulp": errors.max().item(),
+            "mean_ulp": errors.mean().item(),
+        }
+    )
+
+    bound = ULP_BOUNDS[accuracy].get(mathop)
+    if bound is None:
+        assert passed_test(
+            golden_tensor.to(format_dict[formats.output_format]),
+            res_tensor,
+            formats.output_format,
+        ), "Assert against golden failed"
+    else:
+        max_ulp = errors.max().item()
+        assert (
+            max_ulp <= bound
+        ), f"{mathop.name} {accuracy.name}: {max_ulp:.2f} ulp exceeds {bound}"
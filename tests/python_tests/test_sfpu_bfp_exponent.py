@@ -0,0 +1,107 @@
+# SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import torch
+from helpers.format_config import DataFormat, InputOutputFormat
+from helpers.llk_params import DestAccumulation, format_dict
+from helpers.param_config import parametrize
+from helpers.stimuli_config import StimuliConfig
+from helpers.test_config import TestConfig
+from helpers.test_variant_parameters import APPROX_MODE, TILE_COUNT
+from helpers.tilize_untilize import tilize
+
+TILE_CNT = 2
+NUM_DATUMS = TILE_CNT * 32 * 32
+BLOCK_SIZE = 16
+
+# Magnitude bits of a Bfp datum, the leading one included
+BFP_MAN_BITS = {
+    DataFormat.Bfp8_b: 7,
+    DataFormat.Bfp4_b: 3,
+}
+
+
+def quantize(mag: torch.Tensor, exponent: torch.Tensor, man_bits: int):
+    """Magnitudes on the grid of blocks with biased max exponent, and squared errors."""
+    step = torch.exp2(exponent.to(torch.float32) - 127 - (man_bits - 1))
+    q = torch.round(mag / step).clamp(max=(1 << man_bits) - 1) * step
+    return q, (mag - q) ** 2
+
+
+def bfp_shared_exponent_golden(src: torch.Tensor, man_bits: int):
+    """Model of _calculate_bfp_shared_exponent_ over tilized data, one block per row.
+
+    Returns the quantized tensor and the one with the plain max exponent.
+    """
+    blocks = src.view(-1, BLOCK_SIZE)
+    mag = blocks.abs()
+    max_exp = mag.max(dim=1, keepdim=True).values.view(torch.int32) >> 23
+
+    q, err = quantize(mag, max_exp, man_bits)
+    q_clip, err_clip = quantize(mag, max_exp - 1, man_bits)
+
+    # Lane l holds columns 2l and 2l + 1, and the row sum follows the butterfly of
+    # _sfpu_row_allreduce_x2_
+    lane_diff = (err_clip[:, 0::2] + err_clip[:, 1::2]) - (err[:, 0::2] + err[:, 1::2])
+    pairs = lane_diff[:, :4] + lane_diff[:, 4:]
+    quads = pairs[:, :2] + pairs[:, 2:]
+    diff = quads[:, 0] + quads[:, 1]
+
+    chosen = torch.where(diff.unsqueeze(1) < 0, q_clip, q)
+    return (
+        (chosen * blocks.sign()).flatten(),
+        (q * blocks.sign()).flatten(),
+    )
+
+
+@parametrize(
+    formats=[
+        InputOutputFormat(DataFormat.Float32, DataFormat.Bfp8_b),
+        InputOutputFormat(DataFormat.Float32, DataFormat.Bfp4_b),
+    ],
+)
+def test_sfpu_bfp_exponent(formats, workers_tensix_coordinates):
+    man_bits = BFP_MAN_BITS[formats.output_format]
+
+    torch.manual_seed(0)
+    # Gaussian blocks, every other one with a single outlier just past a power of two,
+    # which is worth clipping in both formats
+    src = torch.randn(NUM_DATUMS // BLOCK_SIZE, BLOCK_SIZE) * 0.5
+    outlier_col = torch.randint(0, BLOCK_SIZE, (NUM_DATUMS // BLOCK_SIZE,))
+    outlier_rows = torch.arange(0, NUM_DATUMS // BLOCK_SIZE, 2)
+    src[outlier_rows, outlier_col[outlier_rows]] = 2.0
+    src = tilize(src.flatten(), formats.input_format)
+
+    golden_tensor, max_exponent_tensor = bfp_shared_exponent_golden(src, man_bits)
+
+    configuration = TestConfig(
+        "sources/sfpu_bfp_exponent_test.cpp",
+        formats,
+        templates=[APPROX_MODE()],
+        runtimes=[TILE_COUNT(TILE_CNT)],
+        variant_stimuli=StimuliConfig(
+            src,
+            formats.input_format,
+            src,
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=TILE_CNT,
+            tile_count_B=TILE_CNT,
+            tile_count_res=TILE_CNT,
+        ),
+        unpack_to_dest=True,
+        dest_acc=DestAccumulation.Yes,
+    )
+
+    res_from_L1 = configuration.run(workers_tensix_coordinates).result[:NUM_DATUMS]
+    res_tensor = torch.tensor(
+        res_from_L1, dtype=format_dict[formats.output_format]
+    ).to(torch.float32)
+
+    # The pre-pass leaves the packer nothing to round
+    assert torch.equal(res_tensor, golden_tensor), "Bfp quantization mismatch"
+
+    error = ((res_tensor - src) ** 2).sum()
+    max_exponent_error = ((max_exponent_tensor - src) ** 2).sum()
+    assert not torch.equal(golden_tensor, max_exponent_tensor), "No block was clipped"
+    assert error < max_exponent_error
@@ -0,0 +1,103 @@
+# SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import torch
+from helpers.format_config import DataFormat
+from helpers.llk_params import (
+    BroadcastType,
+    DestAccumulation,
+    MathOperation,
+    format_dict,
+)
+from helpers.param_config import input_output_formats, parametrize
+from helpers.stimuli_config import StimuliConfig
+from helpers.test_config import TestConfig
+from helpers.test_variant_parameters import APPROX_MODE, BROADCAST_TYPE, MATH_OP
+from helpers.tilize_untilize import tilize
+from helpers.utils import passed_test
+
+# Matches BCAST_SCALAR in sources/sfpu_binary_bcast_test.cpp
+SCALAR = 3.0
+
+OPERATIONS = {
+    MathOperation.SfpuElwadd: torch.add,
+    MathOperation.SfpuElwsub: torch.sub,
+    MathOperation.SfpuElwmul: torch.mul,
+    MathOperation.SfpuElwdiv: torch.div,
+    MathOperation.SfpuElwrsub: lambda a, b: b - a,
+    MathOperation.SfpuElwpow: torch.pow,
+    MathOperation.SfpuXlogy: torch.xlogy,
+}
+
+
+def generate_golden(a, b, mathop, broadcast_type):
+    # a and b are row-major 32x32 tiles; only row 0 or column 0 of b is used
+    a, b = (t.view(32, 32).to(torch.float64) for t in (a, b))
+    if broadcast_type == BroadcastType.Row:
+        b = b[0:1, :]
+    elif broadcast_type == BroadcastType.Column:
+        b = b[:, 0:1]
+    else:
+        b = torch.tensor(SCALAR, dtype=torch.float64)
+    return OPERATIONS[mathop](a, b).flatten()
+
+
+@parametrize(
+    formats=input_output_formats(
+        [DataFormat.Float16_b, DataFormat.Float32],
+        same=True,
+    ),
+    mathop=list(OPERATIONS.keys()),
+    broadcast_type=[BroadcastType.Row, BroadcastType.Column, BroadcastType.Scalar],
+)
+def test_sfpu_binary_bcast(
+    formats, mathop, broadcast_type, workers_tensix_coordinates
+):
+    torch.manual_seed(0)
+    torch_format = format_dict[formats.input_format]
+
+    # Positive operands keep POW and XLOGY real-valued
+    a = (torch.rand(32 * 32) * 1.5 + 0.5).to(torch_format)
+    b = (torch.rand(32 * 32) * 1.5 + 0.5).to(torch_format)
+
+    golden_tensor = tilize(
+        generate_golden(a, b, mathop, broadcast_type), formats.output_format
+    ).to(format_dict[formats.output_format])
+
+    # The kernel sees the operands in dest tile layout
+    a, b = (tilize(t, formats.input_format) for t in (a, b))
+
+    configuration = TestConfig(
+        "sources/sfpu_binary_bcast_test.cpp",
+        formats,
+        templates=[
+            APPROX_MODE(),
+            MATH_OP(mathop=mathop),
+            BROADCAST_TYPE(broadcast_type),
+        ],
+        runtimes=[],
+        variant_stimuli=StimuliConfig(
+            a,
+            formats.input_format,
+            b,
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=1,
+            tile_count_B=1,
+            tile_count_res=1,
+        ),
+        unpack_to_dest=formats.input_format.is_32_bit(),
+        dest_acc=(
+            DestAccumulation.Yes
+            if formats.input_format.is_32_bit()
+            else DestAccumulation.No
+        ),
+    )
+
+    res_from_L1 = configuration.run(workers_tensix_coordinates).result[:1024]
+
+    res_tensor = torch.tensor(res_from_L1, dtype=format_dict[formats.output_format])
+
+    assert passed_test(
+        golden_tensor, res_tensor, formats.output_format
+    ), "Assert against golden failed"
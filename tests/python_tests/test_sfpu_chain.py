@@ -0,0 +1,65 @@
+# SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import pytest
+import torch
+from helpers.format_config import DataFormat
+from helpers.llk_params import ApproximationMode, DestAccumulation, format_dict
+from helpers.param_config import input_output_formats, parametrize
+from helpers.stimuli_config import StimuliConfig
+from helpers.test_config import TestConfig
+from helpers.test_variant_parameters import APPROX_MODE, SFPU_CHAIN
+from helpers.tilize_untilize import tilize
+from helpers.utils import passed_test
+
+
+@parametrize(
+    formats=input_output_formats(
+        [DataFormat.Float16_b, DataFormat.Float32],
+        same=True,
+    ),
+    dest_acc=[DestAccumulation.No, DestAccumulation.Yes],
+    approx_mode=[ApproximationMode.No, ApproximationMode.Yes],
+    swish=[False, True],
+)
+def test_sfpu_chain(formats, dest_acc, approx_mode, swish, workers_tensix_coordinates):
+    if formats.input_format == DataFormat.Float32 and dest_acc == DestAccumulation.No:
+        pytest.skip("DataFormat.Float32 not supported with DestAccumulation.No")
+
+    torch.manual_seed(0)
+    torch_format = format_dict[formats.input_format]
+
+    # Keep exp(x) finite so that the golden and the chain agree on the saturated range
+    x = (torch.rand(32 * 32) * 16 - 8).to(torch_format)
+
+    activation = torch.nn.functional.silu if swish else torch.nn.functional.mish
+    golden_tensor = tilize(activation(x.to(torch.float32)), formats.output_format).to(
+        format_dict[formats.output_format]
+    )
+
+    configuration = TestConfig(
+        "sources/sfpu_chain_test.cpp",
+        formats,
+        templates=[APPROX_MODE(approx_mode), SFPU_CHAIN(swish)],
+        runtimes=[],
+        variant_stimuli=StimuliConfig(
+            tilize(x, formats.input_format),
+            formats.input_format,
+            x,
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=1,
+            tile_count_B=1,
+            tile_count_res=1,
+        ),
+        unpack_to_dest=formats.input_format.is_32_bit(),
+        dest_acc=dest_acc,
+    )
+
+    res_from_L1 = configuration.run(workers_tensix_coordinates).result[:1024]
+
+    res_tensor = torch.tensor(res_from_L1, dtype=format_dict[formats.output_format])
+
+    assert passed_test(
+        golden_tensor, res_tensor, formats.output_format
+    ), "Assert against golden failed"
@@ -0,0 +1,98 @@
+# SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import torch
+from helpers.format_config import DataFormat
+from helpers.llk_params import ApproximationMode, DestAccumulation, format_dict
+from helpers.param_config import input_output_formats, parametrize
+from helpers.stimuli_config import StimuliConfig
+from helpers.test_config import TestConfig
+from helpers.test_variant_parameters import APPROX_MODE, NLL, TILE_COUNT
+from helpers.tilize_untilize import tilize_block, untilize_block
+
+# Match the constants of sources/sfpu_logsumexp_test.cpp
+NUM_COL_TILES = 3
+NUM_IN_TILES = NUM_COL_TILES + 2
+NUM_OUT_TILES = NUM_COL_TILES + 1
+ROWS = 32
+VOCAB = 32 * NUM_COL_TILES
+
+
+@parametrize(
+    formats=input_output_formats([DataFormat.Float32], same=True),
+    approx_mode=[ApproximationMode.No, ApproximationMode.Yes],
+    nll_en=[False, True],
+)
+def test_sfpu_logsumexp(formats, approx_mode, nll_en, workers_tensix_coordinates):
+    torch.manual_seed(0)
+    logits = torch.randn(ROWS, VOCAB, dtype=torch.float32) * 4
+    # A few rows peak in a later tile, so the running max is rescaled across tiles
+    logits[::4, -1] += 20
+    target = torch.randint(0, VOCAB, (ROWS,))
+
+    # Target class index broadcast along its row; the state tile starts as garbage
+    target_tile = target.to(torch.float32).unsqueeze(1).expand(ROWS, 32)
+    garbage_tile = torch.full((ROWS, 32), 1e30)
+    src = torch.cat(
+        [
+            tilize_block(
+                logits, dimensions=[ROWS, VOCAB], stimuli_format=formats.input_format
+            ).flatten(),
+            tilize_block(
+                target_tile.contiguous(),
+                dimensions=[ROWS, 32],
+                stimuli_format=formats.input_format,
+            ).flatten(),
+            garbage_tile.flatten(),
+        ]
+    )
+
+    configuration = TestConfig(
+        "sources/sfpu_logsumexp_test.cpp",
+        formats,
+        templates=[APPROX_MODE(approx_mode), NLL(nll_en)],
+        runtimes=[TILE_COUNT(NUM_OUT_TILES)],
+        variant_stimuli=StimuliConfig(
+            src,
+            formats.input_format,
+            src,
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=NUM_IN_TILES,
+            tile_count_B=NUM_IN_TILES,
+            tile_count_res=NUM_OUT_TILES,
+        ),
+        unpack_to_dest=True,
+        dest_acc=DestAccumulation.Yes,
+    )
+
+    res_from_L1 = configuration.run(workers_tensix_coordinates).result
+    res_tensor = torch.tensor(
+        res_from_L1[: NUM_OUT_TILES * 1024], dtype=format_dict[formats.output_format]
+    ).to(torch.float32)
+    log_probs = untilize_block(
+        res_tensor[: NUM_COL_TILES * 1024],
+        stimuli_format=formats.output_format,
+        dimensions=[ROWS, VOCAB],
+    )
+    out = untilize_block(
+        res_tensor[NUM_COL_TILES * 1024 :],
+        stimuli_format=formats.output_format,
+        dimensions=[ROWS, 32],
+    )
+
+    # The approximate exp is good to a few percent, which moves the log by about as much
+    atol = 0.05 if approx_mode == ApproximationMode.Yes else 0.01
+
+    # The result is broadcast along each row
+    assert torch.equal(out, out[:, :1].expand(ROWS, 32))
+
+    if nll_en:
+        golden = torch.nn.functional.cross_entropy(logits, target, reduction="none")
+        assert torch.allclose(out[:, 0], golden, atol=atol, rtol=0)
+    else:
+        golden = torch.logsumexp(logits, dim=1)
+        assert torch.allclose(out[:, 0], golden, atol=atol, rtol=0)
+        assert torch.allclose(
+            log_probs, torch.log_softmax(logits, dim=1), atol=atol, rtol=0
+        )
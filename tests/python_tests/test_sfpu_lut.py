@@ -0,0 +1,92 @@
+# SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import pytest
+import torch
+from helpers.format_config import DataFormat
+from helpers.llk_params import DestAccumulation, LutSymmetry, format_dict
+from helpers.param_config import input_output_formats, parametrize
+from helpers.sfpu_lut import fit_lut
+from helpers.stimuli_config import StimuliConfig
+from helpers.test_config import TestConfig
+from helpers.test_variant_parameters import SFPU_LUT
+from helpers.tilize_untilize import tilize
+from helpers.utils import passed_test
+
+# Activation, table domain, symmetry, quadratic segments, max abs fit error of
+# the host table on the stimuli domain
+ACTIVATIONS = {
+    "squared_relu": (
+        lambda x: torch.relu(x) ** 2,
+        (0.0, 4.0),
+        LutSymmetry.Clamp,
+        True,
+        0.01,
+    ),
+    "sigmoid": (torch.sigmoid, (-6.0, 6.0), LutSymmetry.Clamp, False, 0.07),
+    "softsign": (
+        torch.nn.functional.softsign,
+        (-8.0, 8.0),
+        LutSymmetry.Odd,
+        False,
+        0.08,
+    ),
+    "gaussian": (
+        lambda x: torch.exp(-x * x),
+        (-3.0, 3.0),
+        LutSymmetry.Even,
+        True,
+        0.05,
+    ),
+}
+
+
+@parametrize(
+    formats=input_output_formats([DataFormat.Float16_b], same=True),
+    activation=list(ACTIVATIONS.keys()),
+    lut_mode=[0, 1],
+)
+def test_sfpu_lut(formats, activation, lut_mode, workers_tensix_coordinates):
+    function, (lo, hi), symmetry, quadratic, fit_bound = ACTIVATIONS[activation]
+    table = fit_lut(function, lo, hi, symmetry, quadratic, lut_mode)
+
+    torch.manual_seed(0)
+    torch_format = format_dict[formats.input_format]
+    # Stimuli reach past the domain on both sides, where the table clamps,
+    # mirrors or extrapolates
+    src = torch.empty(32 * 32, dtype=torch.float32).uniform_(1.5 * lo, 1.5 * hi)
+    src = src.to(torch_format)
+    src_tilized = tilize(src, formats.input_format)
+
+    in_domain = (src_tilized >= lo) & (src_tilized <= hi)
+    fit_error = (
+        table.evaluate(src_tilized) - function(src_tilized.to(torch.float64))
+    ).abs()[in_domain]
+    assert fit_error.max().item() <= fit_bound, "Host table misses its fit bound"
+
+    golden_tensor = table.evaluate(src_tilized).to(torch_format)
+
+    configuration = TestConfig(
+        "sources/sfpu_lut_test.cpp",
+        formats,
+        templates=[SFPU_LUT(table)],
+        runtimes=[],
+        variant_stimuli=StimuliConfig(
+            src_tilized,
+            formats.input_format,
+            src,
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=1,
+            tile_count_B=1,
+            tile_count_res=1,
+        ),
+        dest_acc=DestAccumulation.No,
+    )
+
+    res_from_L1 = configuration.run(workers_tensix_coordinates).result[:1024]
+    res_tensor = torch.tensor(res_from_L1, dtype=format_dict[formats.output_format])
+
+    assert passed_test(
+        golden_tensor, res_tensor, formats.output_format
+    ), "Assert against golden failed"
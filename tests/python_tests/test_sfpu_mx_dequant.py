@@ -0,0 +1,79 @@
+# SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import torch
+from helpers.format_config import MXFP8_BLOCK_SIZE, DataFormat, InputOutputFormat
+from helpers.llk_params import DestAccumulation, MxFormat, format_dict
+from helpers.param_config import parametrize
+from helpers.stimuli_config import StimuliConfig
+from helpers.stimuli_generator import decode_mx, encode_mx, pack_mx_elements
+from helpers.test_config import TestConfig
+from helpers.test_variant_parameters import APPROX_MODE, MX_FORMAT, TILE_COUNT
+from helpers.utils import passed_test
+
+TILE_CNT = 2
+TILE_NUM_DATUMS = 32 * 32
+NUM_BLOCKS_PER_TILE = TILE_NUM_DATUMS // MXFP8_BLOCK_SIZE
+
+# MX elements are bit-packed into a UInt32 tile and dequantized to fp32 in dest
+MX_DEQUANT_FORMATS = [
+    InputOutputFormat(DataFormat.UInt32, DataFormat.Float32),
+    InputOutputFormat(DataFormat.UInt32, DataFormat.Float16_b),
+]
+
+
+@parametrize(
+    formats=MX_DEQUANT_FORMATS,
+    mx_format=[
+        MxFormat.MxFp4,
+        MxFormat.MxFp6E2M3,
+        MxFormat.MxFp6E3M2,
+        MxFormat.MxInt8,
+    ],
+)
+def test_sfpu_mx_dequant(formats, mx_format, workers_tensix_coordinates):
+    torch.manual_seed(0)
+    # Blocks with different magnitudes, so that every tile uses a spread of scales
+    num_blocks = TILE_CNT * NUM_BLOCKS_PER_TILE
+    block_magnitudes = torch.exp2(torch.randint(-8, 8, (num_blocks, 1)))
+    weights = torch.randn(num_blocks, MXFP8_BLOCK_SIZE) * block_magnitudes
+
+    scales, elements = encode_mx(weights.flatten(), mx_format)
+    golden_tensor = decode_mx(scales, elements, mx_format).to(
+        format_dict[formats.output_format]
+    )
+
+    # Every MX tile fits in the one packed tile
+    packed = pack_mx_elements(elements, mx_format)
+
+    # The scales of each tile go at the start of its buffer_B tile, four to a word
+    scale_tiles = torch.zeros(TILE_CNT, 4 * TILE_NUM_DATUMS, dtype=torch.uint8)
+    scale_tiles[:, :NUM_BLOCKS_PER_TILE] = scales.view(TILE_CNT, -1)
+    scale_words = scale_tiles.view(torch.int32).to(torch.int64) & 0xFFFFFFFF
+
+    configuration = TestConfig(
+        "sources/sfpu_mx_dequant_test.cpp",
+        formats,
+        templates=[APPROX_MODE(), MX_FORMAT(mx_format)],
+        runtimes=[TILE_COUNT(TILE_CNT)],
+        variant_stimuli=StimuliConfig(
+            packed,
+            formats.input_format,
+            scale_words.flatten(),
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=1,
+            tile_count_B=TILE_CNT,
+            tile_count_res=TILE_CNT,
+        ),
+        unpack_to_dest=True,
+        dest_acc=DestAccumulation.Yes,
+    )
+
+    res_from_L1 = configuration.run(workers_tensix_coordinates).result
+    res_tensor = torch.tensor(
+        res_from_L1[: TILE_CNT * TILE_NUM_DATUMS],
+        dtype=format_dict[formats.output_format],
+    )
+
+    assert passed_test(golden_tensor, res_tensor, formats.output_format)
@@ -0,0 +1,108 @@
+# SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import torch
+from helpers.format_config import DataFormat, InputOutputFormat
+from helpers.llk_params import DestAccumulation, OptimizerType, format_dict
+from helpers.param_config import parametrize
+from helpers.stimuli_config import StimuliConfig
+from helpers.test_config import TestConfig
+from helpers.test_variant_parameters import APPROX_MODE, SFPU_OPTIMIZER
+from helpers.tilize_untilize import tilize
+from helpers.utils import passed_test
+
+
+def generate_golden(p, g, m, v, optimizer: SFPU_OPTIMIZER):
+    """Reference step in the form of torch.optim, returning the new p, m and v."""
+    beta1, beta2, lr, wd = (
+        optimizer.beta1,
+        optimizer.beta2,
+        optimizer.lr,
+        optimizer.weight_decay,
+    )
+
+    if optimizer.optimizer == OptimizerType.Lion:
+        update = torch.sign(beta1 * m + (1 - beta1) * g)
+        p = p * (1 - lr * wd) - lr * update
+        m = beta2 * m + (1 - beta2) * g
+        return p, m, v
+
+    if optimizer.optimizer == OptimizerType.Adam:
+        g = g + wd * p
+    else:
+        p = p * (1 - lr * wd)
+
+    m = beta1 * m + (1 - beta1) * g
+    v = beta2 * v + (1 - beta2) * g * g
+    m_hat = m / (1 - beta1**optimizer.step)
+    v_hat = v / (1 - beta2**optimizer.step)
+    p = p - lr * m_hat / (torch.sqrt(v_hat) + optimizer.eps)
+    return p, m, v
+
+
+@parametrize(
+    formats=[
+        InputOutputFormat(DataFormat.Float32, DataFormat.Float32),
+        InputOutputFormat(DataFormat.Float32, DataFormat.Float16_b),
+        # 16-bit dest, so the kernel rounds the state to bfloat16 on every store
+        InputOutputFormat(DataFormat.Float16_b, DataFormat.Float16_b),
+    ],
+    optimizer_type=[OptimizerType.Adam, OptimizerType.AdamW, OptimizerType.Lion],
+)
+def test_sfpu_optimizer(formats, optimizer_type, workers_tensix_coordinates):
+    optimizer = SFPU_OPTIMIZER(
+        optimizer_type,
+        lr=1e-3,
+        beta1=0.9,
+        beta2=0.99 if optimizer_type == OptimizerType.Lion else 0.999,
+        eps=1e-8,
+        weight_decay=1e-2,
+        step=10,
+    )
+
+    fp32_dest = formats.input_format.is_32_bit()
+
+    torch.manual_seed(0)
+    torch_format = format_dict[formats.input_format]
+
+    # State as it would look a few steps into training
+    p = torch.randn(32 * 32).to(torch_format)
+    g = (torch.randn(32 * 32) * 0.1).to(torch_format)
+    m = (torch.randn(32 * 32) * 0.05).to(torch_format)
+    v = (torch.rand(32 * 32) * 1e-2).to(torch_format)
+
+    # Elementwise, so the golden is computed directly in tile order
+    p, g, m, v = (tilize(t, formats.input_format) for t in (p, g, m, v))
+    golden_tensor = torch.cat(
+        generate_golden(*(t.to(torch.float64) for t in (p, g, m, v)), optimizer)
+    ).to(format_dict[formats.output_format])
+
+    configuration = TestConfig(
+        "sources/sfpu_optimizer_test.cpp",
+        formats,
+        templates=[APPROX_MODE(), optimizer],
+        runtimes=[],
+        variant_stimuli=StimuliConfig(
+            p,
+            formats.input_format,
+            g,
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=1,
+            tile_count_B=1,
+            tile_count_res=3,
+            buffer_C=torch.cat((m, v)),
+            stimuli_C_format=formats.input_format,
+            tile_count_C=2,
+        ),
+        unpack_to_dest=fp32_dest,
+        dest_acc=DestAccumulation.Yes if fp32_dest else DestAccumulation.No,
+    )
+
+    res_from_L1 = configuration.run(workers_tensix_coordinates).result[: 3 * 1024]
+
+    res_tensor = torch.tensor(res_from_L1, dtype=format_dict[formats.output_format])
+
+    assert passed_test(
+        golden_tensor, res_tensor, formats.output_format
+    ), "Assert against golden failed"
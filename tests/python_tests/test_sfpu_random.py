@@ -0,0 +1,83 @@
+# SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import pytest
+import torch
+from helpers.format_config import DataFormat
+from helpers.llk_params import DestAccumulation, format_dict
+from helpers.param_config import input_output_formats, parametrize
+from helpers.stimuli_config import StimuliConfig
+from helpers.test_config import TestConfig
+from helpers.test_variant_parameters import APPROX_MODE
+from helpers.threefry import threefry2x32, threefry_tile
+from helpers.tilize_untilize import tilize
+from helpers.utils import passed_test
+
+# Match the constants of sources/sfpu_random_test.cpp
+SEED = 0x2545F491
+STREAM = 7
+TILE_INDEX = 42
+PROBABILITY = 0x40000000
+SCALE = 2.0
+
+
+# Known-answer vectors of Threefry-2x32-20 from Random123 (kat_vectors)
+THREEFRY_KAT = [
+    ((0x00000000, 0x00000000), (0x00000000, 0x00000000), (0x6B200159, 0x99BA4EFE)),
+    ((0xFFFFFFFF, 0xFFFFFFFF), (0xFFFFFFFF, 0xFFFFFFFF), (0x1CB996FC, 0xBB002BE7)),
+    ((0x243F6A88, 0x85A308D3), (0x13198A2E, 0x03707344), (0xC4923A9C, 0x483DF7A0)),
+]
+
+
+@pytest.mark.parametrize("counter, key, expected", THREEFRY_KAT)
+def test_threefry_kat(counter, key, expected):
+    # Host only: the goldens of the random kernels are only as good as this model
+    assert threefry2x32(counter, key) == expected
+
+
+@parametrize(
+    formats=input_output_formats([DataFormat.Float32], same=True),
+)
+def test_sfpu_random(formats, workers_tensix_coordinates):
+    torch.manual_seed(0)
+    torch_format = format_dict[formats.input_format]
+
+    src = torch.randn(32 * 32).to(torch_format)
+    src = tilize(src, formats.input_format)
+
+    # Tile 0: dropout keyed on TILE_INDEX, tile 1: uniform fill keyed on TILE_INDEX + 1
+    dropped = (threefry_tile(SEED, STREAM, TILE_INDEX) >> 1) < PROBABILITY
+    dropout_golden = torch.where(dropped, 0.0, src.to(torch.float32) * SCALE)
+    uniform_bits = threefry_tile(SEED, STREAM, TILE_INDEX + 1) >> 9
+    uniform_golden = uniform_bits.to(torch.float32) * 2.0**-23
+    golden_tensor = torch.cat((dropout_golden, uniform_golden)).to(
+        format_dict[formats.output_format]
+    )
+
+    configuration = TestConfig(
+        "sources/sfpu_random_test.cpp",
+        formats,
+        templates=[APPROX_MODE()],
+        runtimes=[],
+        variant_stimuli=StimuliConfig(
+            src,
+            formats.input_format,
+            src,
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=1,
+            tile_count_B=1,
+            tile_count_res=2,
+        ),
+        unpack_to_dest=True,
+        dest_acc=DestAccumulation.Yes,
+    )
+
+    res_from_L1 = configuration.run(workers_tensix_coordinates).result[: 2 * 1024]
+    res_tensor = torch.tensor(res_from_L1, dtype=format_dict[formats.output_format])
+
+    # The mask is a hash of the counters, so it has to match exactly
+    assert torch.equal(res_tensor[:1024] == 0, dropped), "Dropout mask mismatch"
+    assert passed_test(
+        golden_tensor, res_tensor, formats.output_format
+    ), "Assert against golden failed"
@@ -0,0 +1,108 @@
+# SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import torch
+from helpers.format_config import DataFormat
+from helpers.llk_params import DestAccumulation
+from helpers.param_config import input_output_formats, parametrize
+from helpers.stimuli_config import StimuliConfig
+from helpers.test_config import TestConfig
+from helpers.test_variant_parameters import APPROX_MODE, REQUANT
+from helpers.tilize_untilize import tilize
+
+ZERO_POINT = 5.0
+
+
+def to_sign_magnitude(t: torch.Tensor) -> torch.Tensor:
+    """Int32 in the sign-magnitude encoding the kernel loads and stores."""
+    mag = t.abs().to(torch.int64)
+    out = torch.where(t < 0, mag | (1 << 31), mag)
+    return torch.where(out >= 1 << 31, out - (1 << 32), out).to(torch.int32)
+
+
+def from_sign_magnitude(t: torch.Tensor) -> torch.Tensor:
+    bits = t.to(torch.int64) & 0xFFFFFFFF
+    mag = bits & 0x7FFFFFFF
+    return torch.where(bits >= 1 << 31, -mag, mag).to(torch.int32)
+
+
+def requant_golden(acc, scale, relu, unsigned_output):
+    """acc and scale in tilized order, scale already broadcast down the columns."""
+    if relu:
+        # SFPMUL, then the zero point with a separate SFPADD
+        out = (acc.to(torch.float32) * scale).clamp(min=0.0) + ZERO_POINT
+    else:
+        # SFPMAD rounds once
+        out = (acc.to(torch.float64) * scale.to(torch.float64) + ZERO_POINT).to(
+            torch.float32
+        )
+    low, high = (0, 255) if unsigned_output else (-128, 127)
+    return torch.round(out).clamp(low, high).to(torch.int32)
+
+
+@parametrize(
+    formats=input_output_formats([DataFormat.Int32], same=True),
+    relu=[False, True],
+    unsigned_output=[False, True],
+    sign_magnitude=[False, True],
+)
+def test_sfpu_requant(
+    formats, relu, unsigned_output, sign_magnitude, workers_tensix_coordinates
+):
+    torch.manual_seed(0)
+
+    # Accumulators well inside the 24 bits an fp32 holds exactly, and one scale per
+    # column, so that both ends saturate
+    acc = torch.randint(-30000, 30000, (32, 32), dtype=torch.int32)
+    channel_scale = torch.rand(32) * 0.02 + 1e-3
+    scale = torch.zeros(32, 32)
+    scale[0] = channel_scale
+
+    golden_tensor = requant_golden(
+        tilize(acc.flatten(), formats.input_format),
+        tilize(channel_scale.expand(32, 32).flatten(), DataFormat.Float32),
+        relu,
+        unsigned_output,
+    )
+
+    acc = tilize(acc.flatten(), formats.input_format)
+    if sign_magnitude:
+        acc = to_sign_magnitude(acc)
+    # The scales travel as their fp32 bits, unpacked to dest as they are
+    scale = tilize(scale.flatten(), DataFormat.Float32).view(torch.int32)
+
+    configuration = TestConfig(
+        "sources/sfpu_requant_test.cpp",
+        formats,
+        templates=[
+            APPROX_MODE(),
+            REQUANT(relu, unsigned_output, sign_magnitude, ZERO_POINT),
+        ],
+        runtimes=[],
+        variant_stimuli=StimuliConfig(
+            acc,
+            formats.input_format,
+            scale,
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=1,
+            tile_count_B=1,
+            tile_count_res=1,
+        ),
+        unpack_to_dest=True,
+        dest_acc=DestAccumulation.Yes,
+    )
+
+    res_from_L1 = configuration.run(workers_tensix_coordinates).result[:1024]
+    res_tensor = torch.tensor(res_from_L1, dtype=torch.int32)
+    if sign_magnitude:
+        res_tensor = from_sign_magnitude(res_tensor)
+
+    # Ties of the final rounding may go either way after the SFPU arithmetic
+    diff = (res_tensor - golden_tensor).abs()
+    assert diff.max().item() <= 1, "Requantised values off by more than one"
+    assert (diff == 0).float().mean().item() > 0.99, "Too many rounding mismatches"
+    assert (golden_tensor == (255 if unsigned_output else 127)).any()
+    # ReLU lifts the bottom of the range to the zero point
+    low = ZERO_POINT if relu else (0 if unsigned_output else -128)
+    assert (golden_tensor == low).any()
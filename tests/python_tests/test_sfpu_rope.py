@@ -0,0 +1,85 @@
+# SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import pytest
+import torch
+from helpers.format_config import DataFormat
+from helpers.llk_params import DestAccumulation, RopeMode, format_dict
+from helpers.param_config import input_output_formats, parametrize
+from helpers.stimuli_config import StimuliConfig
+from helpers.test_config import TestConfig
+from helpers.test_variant_parameters import APPROX_MODE, ROPE_MODE
+from helpers.tilize_untilize import tilize
+from helpers.utils import passed_test
+
+
+def generate_golden(x, cos, sin, rope_mode):
+    # x, cos and sin are row-major 32x32 tiles; each row is one head of dim 32
+    x, cos, sin = (t.view(32, 32).to(torch.float32) for t in (x, cos, sin))
+    if rope_mode == RopeMode.Interleaved:
+        a, b = x[:, 0::2], x[:, 1::2]
+        rotated = torch.stack((-b, a), dim=-1).flatten(-2)
+        return (x * cos + rotated * sin).flatten()
+
+    # Half split: cos/sin are read at the first element of each pair only
+    a, b = x[:, :16], x[:, 16:]
+    c, s = cos[:, :16], sin[:, :16]
+    return torch.cat((a * c - b * s, b * c + a * s), dim=-1).flatten()
+
+
+@parametrize(
+    formats=input_output_formats(
+        [DataFormat.Float16_b, DataFormat.Float32],
+        same=True,
+    ),
+    dest_acc=[DestAccumulation.No, DestAccumulation.Yes],
+    rope_mode=[RopeMode.Interleaved, RopeMode.HalfSplit],
+)
+def test_sfpu_rope(formats, dest_acc, rope_mode, workers_tensix_coordinates):
+    if formats.input_format == DataFormat.Float32 and dest_acc == DestAccumulation.No:
+        pytest.skip("DataFormat.Float32 not supported with DestAccumulation.No")
+
+    torch.manual_seed(0)
+    torch_format = format_dict[formats.input_format]
+
+    x = torch.randn(32 * 32).to(torch_format)
+    theta = torch.rand(32 * 32) * 2 * torch.pi
+    cos = torch.cos(theta).to(torch_format)
+    sin = torch.sin(theta).to(torch_format)
+
+    golden_tensor = tilize(
+        generate_golden(x, cos, sin, rope_mode), formats.output_format
+    ).to(format_dict[formats.output_format])
+
+    # The kernel sees the operands in dest tile layout
+    x, cos, sin = (tilize(t, formats.input_format) for t in (x, cos, sin))
+
+    configuration = TestConfig(
+        "sources/sfpu_rope_test.cpp",
+        formats,
+        templates=[APPROX_MODE(), ROPE_MODE(rope_mode)],
+        runtimes=[],
+        variant_stimuli=StimuliConfig(
+            x,
+            formats.input_format,
+            cos,
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=1,
+            tile_count_B=1,
+            tile_count_res=1,
+            buffer_C=sin,
+            stimuli_C_format=formats.input_format,
+            tile_count_C=1,
+        ),
+        unpack_to_dest=formats.input_format.is_32_bit(),
+        dest_acc=dest_acc,
+    )
+
+    res_from_L1 = configuration.run(workers_tensix_coordinates).result[:1024]
+
+    res_tensor = torch.tensor(res_from_L1, dtype=format_dict[formats.output_format])
+
+    assert passed_test(
+        golden_tensor, res_tensor, formats.output_format
+    ), "Assert against golden failed"
@@ -0,0 +1,96 @@
+# SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import torch
+from helpers.format_config import DataFormat
+from helpers.llk_params import ApproximationMode, DestAccumulation, format_dict
+from helpers.param_config import input_output_formats, parametrize
+from helpers.stimuli_config import StimuliConfig
+from helpers.test_config import TestConfig
+from helpers.test_variant_parameters import APPROX_MODE, SOFTCAP, TILE_COUNT
+from helpers.tilize_untilize import tilize_block, untilize_block
+
+# Match the constant of sources/sfpu_softmax_exp_test.cpp
+SOFTMAX_SCALE = 0.125
+TILE_CNT = 2
+DIMENSIONS = [32 * TILE_CNT, 32]
+
+
+@parametrize(
+    formats=input_output_formats([DataFormat.Float32], same=True),
+    approx_mode=[ApproximationMode.No, ApproximationMode.Yes],
+    # 0 disables the softcap; 30 and 50 are the caps attention models use
+    softcap=[0.0, 30.0, 50.0],
+)
+def test_sfpu_softmax_exp(formats, approx_mode, softcap, workers_tensix_coordinates):
+    torch.manual_seed(0)
+    softcap_en = softcap > 0.0
+    scores = torch.randn(DIMENSIONS, dtype=torch.float32) * 8
+
+    if softcap_en:
+        # Shift the rows down to -800, so that many capped row maxima sit more than 87
+        # below the cap, where subtracting the cap instead of the row max flushes to 0
+        scores = scores - torch.linspace(0.0, 800.0, DIMENSIONS[0]).unsqueeze(1)
+        row_max = scores.max(dim=1, keepdim=True).values.expand(DIMENSIONS)
+        capped = torch.tanh(scores.double() * (SOFTMAX_SCALE / softcap)) * softcap
+        golden_numerator = torch.exp(capped - capped.max(dim=1, keepdim=True).values)
+        golden_softmax = torch.softmax(capped, dim=1)
+    else:
+        # The kernel expects scores with the row max already subtracted
+        scores = scores - scores.max(dim=1, keepdim=True).values
+        row_max = scores
+        golden_numerator = torch.exp(scores.double() * SOFTMAX_SCALE)
+        golden_softmax = torch.softmax(scores.double() * SOFTMAX_SCALE, dim=1)
+
+    src_A = tilize_block(
+        scores, dimensions=DIMENSIONS, stimuli_format=formats.input_format
+    )
+    src_B = tilize_block(
+        row_max.contiguous(),
+        dimensions=DIMENSIONS,
+        stimuli_format=formats.input_format,
+    )
+
+    configuration = TestConfig(
+        "sources/sfpu_softmax_exp_test.cpp",
+        formats,
+        templates=[
+            APPROX_MODE(approx_mode),
+            SOFTCAP(softcap_en=softcap_en, softcap=softcap),
+        ],
+        runtimes=[TILE_COUNT(TILE_CNT)],
+        variant_stimuli=StimuliConfig(
+            src_A.flatten(),
+            formats.input_format,
+            src_B.flatten(),
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=TILE_CNT,
+            tile_count_B=TILE_CNT,
+            tile_count_res=TILE_CNT,
+        ),
+        unpack_to_dest=True,
+        dest_acc=DestAccumulation.Yes,
+    )
+
+    res_from_L1 = configuration.run(workers_tensix_coordinates).result
+    res_tensor = torch.tensor(
+        res_from_L1[: TILE_CNT * 1024], dtype=format_dict[formats.output_format]
+    )
+    numerator = untilize_block(
+        res_tensor, stimuli_format=formats.output_format, dimensions=DIMENSIONS
+    ).to(torch.float64)
+
+    # Every row keeps its max at exp(0) = 1, so no row sum is zero and the softmax
+    # has no NaN
+    row_sums = numerator.sum(dim=1)
+    assert torch.all(row_sums >= 0.99), "A row of numerators flushed to zero"
+
+    # The approximate exp is good to a few percent, the accurate one to a few bf16 ulp
+    rtol = 0.05 if approx_mode == ApproximationMode.Yes else 0.01
+    assert torch.allclose(numerator, golden_numerator, rtol=rtol, atol=1e-6)
+
+    # Normalised on the host, the numerators give the softmax of the soft-capped scores
+    softmax = numerator / row_sums.unsqueeze(1)
+    assert not torch.isnan(softmax).any()
+    assert torch.allclose(softmax, golden_softmax, rtol=rtol, atol=1e-4)
@@ -0,0 +1,112 @@
+# SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import torch
+from helpers.format_config import DataFormat
+from helpers.llk_params import DestAccumulation, format_dict
+from helpers.param_config import input_output_formats, parametrize
+from helpers.stimuli_config import StimuliConfig
+from helpers.test_config import TestConfig
+from helpers.test_variant_parameters import (
+    APPROX_MODE,
+    STOCHASTIC_ROUND_MAN_BITS,
+    TILE_COUNT,
+)
+from helpers.threefry import threefry_tile
+from helpers.tilize_untilize import tilize
+
+# Match the constants of sources/sfpu_stochastic_round_test.cpp
+SEED = 0x2545F491
+STREAM = 3
+TILE_CNT = 2
+
+
+def round_bits(bits: torch.Tensor, random: torch.Tensor, man_bits: int) -> torch.Tensor:
+    """Adds the top dropped bits of random to the fp32 bits and truncates."""
+    dropped_bits = 23 - man_bits
+    return (bits + (random >> (32 - dropped_bits))) & ~((1 << dropped_bits) - 1)
+
+
+def stochastic_round_golden(
+    src: torch.Tensor, man_bits: int, min_exp: int
+) -> torch.Tensor:
+    """Rounds each tile with the Threefry words keyed on its index."""
+    random = torch.cat([threefry_tile(SEED, STREAM, i) for i in range(TILE_CNT)])
+    bits = src.view(torch.int32).to(torch.int64) & 0xFFFFFFFF
+    sign = bits & 0x80000000
+    mag = bits & 0x7FFFFFFF
+    rounded = round_bits(mag, random, man_bits)
+
+    if min_exp > -126:
+        # Below the target's smallest normal, round on the grid of its binade
+        min_normal = 2.0**min_exp
+        biased = mag.to(torch.int32).view(torch.float32) + min_normal
+        biased = round_bits(biased.view(torch.int32).to(torch.int64), random, man_bits)
+        subnormal = biased.to(torch.int32).view(torch.float32) - min_normal
+        rounded = torch.where(
+            mag < (127 + min_exp) << 23,
+            subnormal.view(torch.int32).to(torch.int64),
+            rounded,
+        )
+
+    mag = torch.where(mag < 0x7F800000, rounded, mag)
+    out = sign | mag
+    out = torch.where(out >= 1 << 31, out - (1 << 32), out).to(torch.int32)
+    return out.view(torch.float32)
+
+
+@parametrize(
+    formats=input_output_formats([DataFormat.Float32], same=True),
+    # Float16_b, Float16 and FP8 E4M3 mantissas and smallest normals
+    man_bits_min_exp=[(7, -126), (10, -14), (3, -6)],
+)
+def test_sfpu_stochastic_round(formats, man_bits_min_exp, workers_tensix_coordinates):
+    man_bits, min_exp = man_bits_min_exp
+    torch.manual_seed(0)
+    # Magnitudes down to a few binades below the target's smallest normal
+    lowest_exp = max(min_exp - man_bits - 2, -120)
+    src = torch.randn(TILE_CNT * 32 * 32) * torch.exp2(
+        torch.randint(lowest_exp, 3, (TILE_CNT * 32 * 32,)).to(torch.float32)
+    )
+    # Target subnormals keep no bits below 2^(min_exp - 23), so that adding the
+    # smallest normal on the SFPU is exact whatever its rounding
+    grid = 2.0 ** (min_exp - 23)
+    src = torch.where(
+        src.abs() < 2.0**min_exp, torch.trunc(src.to(torch.float64) / grid) * grid, src
+    ).to(torch.float32)
+    src = tilize(src, formats.input_format)
+
+    golden_tensor = stochastic_round_golden(src, man_bits, min_exp)
+
+    configuration = TestConfig(
+        "sources/sfpu_stochastic_round_test.cpp",
+        formats,
+        templates=[APPROX_MODE(), STOCHASTIC_ROUND_MAN_BITS(man_bits, min_exp)],
+        runtimes=[TILE_COUNT(TILE_CNT)],
+        variant_stimuli=StimuliConfig(
+            src,
+            formats.input_format,
+            src,
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=TILE_CNT,
+            tile_count_B=TILE_CNT,
+            tile_count_res=TILE_CNT,
+        ),
+        unpack_to_dest=True,
+        dest_acc=DestAccumulation.Yes,
+    )
+
+    res_from_L1 = configuration.run(workers_tensix_coordinates).result
+    res_tensor = torch.tensor(
+        res_from_L1[: TILE_CNT * 1024], dtype=format_dict[formats.output_format]
+    )
+
+    # The rounding is a function of (seed, stream, tile index), so it is exact
+    assert torch.equal(res_tensor, golden_tensor), "Stochastic rounding mismatch"
+    # Unbiased: the mean rounding error stays well below one ulp of the target, whose
+    # grid stops shrinking at the smallest normal
+    exponent = torch.floor(torch.log2(src.abs())).clamp(min=min_exp)
+    ulp = torch.exp2(exponent - man_bits)
+    mean_error = ((res_tensor - src) / ulp).mean().item()
+    assert abs(mean_error) < 0.05, f"Rounding is biased, mean error {mean_error} ulp"
@@ -0,0 +1,81 @@
+# SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import pytest
+import torch
+from helpers.format_config import DataFormat
+from helpers.llk_params import DestAccumulation, TernaryOp, format_dict
+from helpers.param_config import input_output_formats, parametrize
+from helpers.stimuli_config import StimuliConfig
+from helpers.test_config import TestConfig
+from helpers.test_variant_parameters import APPROX_MODE, TERNARY_OP
+from helpers.tilize_untilize import tilize
+from helpers.utils import passed_test
+
+# Matches TERNARY_VALUE in sources/sfpu_ternary_test.cpp
+VALUE = 0.5
+
+OPERATIONS = {
+    TernaryOp.Fma: lambda a, b, c: a * b + c,
+    TernaryOp.Lerp: torch.lerp,
+    TernaryOp.Addcmul: lambda a, b, c: torch.addcmul(a, b, c, value=VALUE),
+    TernaryOp.Addcdiv: lambda a, b, c: torch.addcdiv(a, b, c, value=VALUE),
+    TernaryOp.Clamp: lambda a, b, c: torch.clamp(a, min=b, max=c),
+}
+
+
+@parametrize(
+    formats=input_output_formats(
+        [DataFormat.Float16_b, DataFormat.Float32],
+        same=True,
+    ),
+    dest_acc=[DestAccumulation.No, DestAccumulation.Yes],
+    ternary_op=list(OPERATIONS.keys()),
+)
+def test_sfpu_ternary(formats, dest_acc, ternary_op, workers_tensix_coordinates):
+    if formats.input_format == DataFormat.Float32 and dest_acc == DestAccumulation.No:
+        pytest.skip("DataFormat.Float32 not supported with DestAccumulation.No")
+
+    torch.manual_seed(0)
+    torch_format = format_dict[formats.input_format]
+
+    a = torch.randn(32 * 32).to(torch_format)
+    b = torch.randn(32 * 32).to(torch_format)
+    # Positive and away from zero, so that ADDCDIV stays finite
+    c = (torch.rand(32 * 32) * 1.5 + 0.5).to(torch_format)
+
+    # Elementwise, so the golden is computed directly in tile order
+    a, b, c = (tilize(t, formats.input_format) for t in (a, b, c))
+    golden_tensor = OPERATIONS[ternary_op](
+        a.to(torch.float64), b.to(torch.float64), c.to(torch.float64)
+    ).to(format_dict[formats.output_format])
+
+    configuration = TestConfig(
+        "sources/sfpu_ternary_test.cpp",
+        formats,
+        templates=[APPROX_MODE(), TERNARY_OP(ternary_op)],
+        runtimes=[],
+        variant_stimuli=StimuliConfig(
+            a,
+            formats.input_format,
+            b,
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=1,
+            tile_count_B=1,
+            tile_count_res=1,
+            buffer_C=c,
+            stimuli_C_format=formats.input_format,
+            tile_count_C=1,
+        ),
+        unpack_to_dest=formats.input_format.is_32_bit(),
+        dest_acc=dest_acc,
+    )
+
+    res_from_L1 = configuration.run(workers_tensix_coordinates).result[:1024]
+
+    res_tensor = torch.tensor(res_from_L1, dtype=format_dict[formats.output_format])
+
+    assert passed_test(
+        golden_tensor, res_tensor, formats.output_format
+    ), "Assert against golden failed"
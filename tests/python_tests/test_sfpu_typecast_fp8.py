@@ -0,0 +1,76 @@
+# SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import torch
+from helpers.format_config import DataFormat, InputOutputFormat
+from helpers.llk_params import DestAccumulation, Fp8Format, format_dict
+from helpers.param_config import parametrize
+from helpers.stimuli_config import StimuliConfig
+from helpers.test_config import TestConfig
+from helpers.test_variant_parameters import APPROX_MODE, FP8_TYPECAST, TILE_COUNT
+from helpers.utils import passed_test
+
+TILE_CNT = 2
+NUM_DATUMS = TILE_CNT * 32 * 32
+
+FP8_DTYPES = {
+    Fp8Format.E4M3: torch.float8_e4m3fn,
+    Fp8Format.E5M2: torch.float8_e5m2,
+}
+
+# FP8 tiles live in L1 as UInt8 codes: fp32 -> FP8 encodes, FP8 -> fp32 decodes
+FP8_TYPECAST_FORMATS = [
+    InputOutputFormat(DataFormat.Float32, DataFormat.UInt8),
+    InputOutputFormat(DataFormat.UInt8, DataFormat.Float32),
+]
+
+
+@parametrize(
+    formats=FP8_TYPECAST_FORMATS,
+    fp8_format=[Fp8Format.E4M3, Fp8Format.E5M2],
+)
+def test_sfpu_typecast_fp8(formats, fp8_format, workers_tensix_coordinates):
+    encode = formats.input_format == DataFormat.Float32
+    fp8_dtype = FP8_DTYPES[fp8_format]
+    fp8_max = torch.finfo(fp8_dtype).max
+
+    torch.manual_seed(0)
+    if encode:
+        # Magnitudes over the subnormal, normal and saturating ranges of both formats
+        exponents = torch.randint(-24, 20, (NUM_DATUMS,)).to(torch.float32)
+        src = torch.randn(NUM_DATUMS) * torch.exp2(exponents)
+        # Saturating cast to FP8, rounding to nearest even
+        golden_tensor = src.clamp(-fp8_max, fp8_max).to(fp8_dtype).view(torch.uint8)
+    else:
+        codes = torch.randint(0, 256, (NUM_DATUMS,), dtype=torch.uint8)
+        # Leave out NaN (and E5M2 infinity) codes, they have no finite golden
+        is_special = codes.view(fp8_dtype).to(torch.float32).isfinite().logical_not()
+        codes = torch.where(is_special, codes & 0x80, codes)
+        src = codes
+        golden_tensor = codes.view(fp8_dtype).to(torch.float32)
+
+    configuration = TestConfig(
+        "sources/sfpu_typecast_fp8_test.cpp",
+        formats,
+        templates=[APPROX_MODE(), FP8_TYPECAST(fp8_format, encode)],
+        runtimes=[TILE_COUNT(TILE_CNT)],
+        variant_stimuli=StimuliConfig(
+            src,
+            formats.input_format,
+            src,
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=TILE_CNT,
+            tile_count_B=TILE_CNT,
+            tile_count_res=TILE_CNT,
+        ),
+        unpack_to_dest=encode,
+        dest_acc=DestAccumulation.Yes,
+    )
+
+    res_from_L1 = configuration.run(workers_tensix_coordinates).result[:NUM_DATUMS]
+    res_tensor = torch.tensor(res_from_L1, dtype=format_dict[formats.output_format])
+
+    # Both directions are exact
+    assert torch.equal(res_tensor, golden_tensor.to(res_tensor.dtype))
+    assert passed_test(golden_tensor, res_tensor, formats.output_format)
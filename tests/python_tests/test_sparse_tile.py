@@ -0,0 +1,157 @@
+# SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import torch
+from helpers.format_config import DataFormat
+from helpers.llk_params import DestAccumulation, format_dict
+from helpers.param_config import input_output_formats, parametrize
+from helpers.stimuli_config import StimuliConfig
+from helpers.stimuli_generator import generate_stimuli
+from helpers.test_config import TestConfig
+from helpers.test_variant_parameters import NUM_FACES, SPARSE_FACE_MASKS, TILE_COUNT
+from helpers.utils import passed_test
+
+FACE_NUM_DATUMS = 256
+TILE_NUM_DATUMS = 4 * FACE_NUM_DATUMS
+SPARSE_TILE_HEADER_SIZE = 16
+
+# Stored faces of each tile. Every tile leaves out at least one face, so that the
+# header fits in the space of a dense tile.
+FACE_MASKS = [0b0111, 0b1010, 0b0000, 0b1001]
+
+
+def header_num_datums(fmt):
+    element_size = torch.tensor([], dtype=format_dict[fmt]).element_size()
+    return SPARSE_TILE_HEADER_SIZE // element_size
+
+
+def zero_faces(tiles, masks):
+    tiles = tiles.clone().view(len(masks), 4, FACE_NUM_DATUMS)
+    for tile, mask in zip(tiles, masks):
+        for face in range(4):
+            if not mask & (1 << face):
+                tile[face] = 0
+    return tiles
+
+
+@parametrize(
+    fmt_dest_acc_unpack_to_dest=[
+        (fmt, DestAccumulation.No, False)
+        for fmt in input_output_formats(
+            [DataFormat.Float16, DataFormat.Float16_b], same=True
+        )
+    ]
+    + [
+        (fmt, DestAccumulation.Yes, True)
+        for fmt in input_output_formats([DataFormat.Int32], same=True)
+    ],
+    detect_zero_faces=[False, True],
+)
+def test_pack_sparse(
+    fmt_dest_acc_unpack_to_dest, detect_zero_faces, workers_tensix_coordinates
+):
+    formats, dest_acc, unpack_to_dest = fmt_dest_acc_unpack_to_dest[0]
+    input_dimensions = [64, 64]
+
+    src_A, tile_cnt_A, src_B, tile_cnt_B = generate_stimuli(
+        stimuli_format_A=formats.input_format,
+        input_dimensions_A=input_dimensions,
+        stimuli_format_B=formats.input_format,
+        input_dimensions_B=input_dimensions,
+    )
+    tiles = zero_faces(src_A, FACE_MASKS)
+    src_A = tiles.flatten()
+
+    configuration = TestConfig(
+        "sources/pack_sparse_test.cpp",
+        formats,
+        templates=[SPARSE_FACE_MASKS(FACE_MASKS, detect_zero_faces)],
+        runtimes=[TILE_COUNT(tile_cnt_A), NUM_FACES()],
+        variant_stimuli=StimuliConfig(
+            src_A,
+            formats.input_format,
+            src_B,
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=tile_cnt_A,
+            tile_count_B=tile_cnt_B,
+            tile_count_res=tile_cnt_A,
+        ),
+        dest_acc=dest_acc,
+        unpack_to_dest=unpack_to_dest,
+    )
+
+    res_from_L1 = configuration.run(workers_tensix_coordinates).result
+    res_tensor = torch.tensor(res_from_L1, dtype=format_dict[formats.output_format])
+
+    header_datums = header_num_datums(formats.output_format)
+    for tile, mask, res_tile in zip(
+        tiles, FACE_MASKS, res_tensor.view(tile_cnt_A, TILE_NUM_DATUMS)
+    ):
+        header = res_tile[:header_datums].view(torch.int32)
+        assert header.tolist() == [mask, 0, 0, 0], "Wrong sparse tile header"
+
+        stored = [face for face in range(4) if mask & (1 << face)]
+        if not stored:
+            continue
+        golden = tile[stored].flatten().to(format_dict[formats.output_format])
+        res_faces = res_tile[header_datums : header_datums + len(golden)]
+        assert passed_test(
+            golden, res_faces, formats.output_format
+        ), "Assert against golden failed"
+
+
+@parametrize(
+    formats=input_output_formats([DataFormat.Float16, DataFormat.Float16_b], same=True)
+)
+def test_unpack_sparse(formats, workers_tensix_coordinates):
+    input_dimensions = [64, 64]
+
+    src_A, tile_cnt_A, src_B, tile_cnt_B = generate_stimuli(
+        stimuli_format_A=formats.input_format,
+        input_dimensions_A=input_dimensions,
+        stimuli_format_B=formats.input_format,
+        input_dimensions_B=input_dimensions,
+    )
+    tiles = zero_faces(src_A, FACE_MASKS)
+
+    # Lay every tile out in sparse format, in the space of a dense tile
+    header_datums = header_num_datums(formats.input_format)
+    sparse = torch.zeros_like(tiles).view(tile_cnt_A, TILE_NUM_DATUMS)
+    for tile, mask, sparse_tile in zip(tiles, FACE_MASKS, sparse):
+        sparse_tile[:header_datums].view(torch.int32)[0] = mask
+        stored = [face for face in range(4) if mask & (1 << face)]
+        stored_datums = tile[stored].flatten()
+        sparse_tile[header_datums : header_datums + len(stored_datums)] = stored_datums
+
+    golden_tensor = tiles.flatten().to(format_dict[formats.output_format])
+
+    configuration = TestConfig(
+        "sources/unpack_sparse_test.cpp",
+        formats,
+        templates=[],
+        runtimes=[TILE_COUNT(tile_cnt_A), NUM_FACES()],
+        variant_stimuli=StimuliConfig(
+            sparse.flatten(),
+            formats.input_format,
+            src_B,
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=tile_cnt_A,
+            tile_count_B=tile_cnt_B,
+            tile_count_res=tile_cnt_A,
+        ),
+        dest_acc=DestAccumulation.No,
+    )
+
+    res_from_L1 = configuration.run(workers_tensix_coordinates).result
+
+    assert len(res_from_L1) == len(
+        golden_tensor
+    ), "Result tensor and golden tensor are not of the same length"
+
+    res_tensor = torch.tensor(res_from_L1, dtype=format_dict[formats.output_format])
+
+    assert passed_test(
+        golden_tensor, res_tensor, formats.output_format
+    ), "Assert against golden failed"
@@ -0,0 +1,175 @@
+# SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import torch
+from helpers.format_config import DataFormat
+from helpers.golden_generators import MatmulGolden, get_golden_generator
+from helpers.llk_params import (
+    DestAccumulation,
+    MathFidelity,
+    MatmulReuse,
+    format_dict,
+)
+from helpers.matmul_sweep import generate_tile_dims
+from helpers.param_config import input_output_formats, parametrize
+from helpers.stimuli_config import StimuliConfig
+from helpers.stimuli_generator import generate_stimuli
+from helpers.test_config import TestConfig
+from helpers.test_variant_parameters import (
+    CRK_TILE_DIMM,
+    MATH_FIDELITY,
+    MATMUL_REUSE,
+    PAGE_TABLE,
+    TILE_COUNT,
+)
+from helpers.tilize_untilize import tilize_block
+from helpers.utils import passed_test
+
+TILE_ELEMENTS = 32 * 32
+
+
+def shuffled_page_order(num_pages: int) -> list[int]:
+    """Physical slot of every logical page: odd pages first, then even ones, so no two
+    consecutive logical pages are adjacent in L1."""
+    return list(range(1, num_pages, 2)) + list(range(0, num_pages, 2))
+
+
+def page_table_tile() -> torch.Tensor:
+    """L1 room for the page table, which the kernel fills in."""
+    return torch.zeros(TILE_ELEMENTS)
+
+
+def scatter_pages(tiles: torch.Tensor, page_order: list[int], tiles_per_page: int):
+    """Lays out logically ordered tiles page by page in their physical slots."""
+    pages = tiles.view(len(page_order), tiles_per_page * TILE_ELEMENTS)
+    physical = torch.empty_like(pages)
+    for page, slot in enumerate(page_order):
+        physical[slot] = pages[page]
+    return physical.flatten()
+
+
+@parametrize(
+    formats=input_output_formats([DataFormat.Float16_b], same=True),
+    log2_tiles_per_page=[0, 1],
+)
+def test_unpack_A_paged(formats, log2_tiles_per_page, workers_tensix_coordinates):
+    tile_cnt = 4
+    tiles_per_page = 1 << log2_tiles_per_page
+    page_order = shuffled_page_order(tile_cnt // tiles_per_page)
+
+    src_A, _, src_B, _ = generate_stimuli(
+        stimuli_format_A=formats.input_format,
+        input_dimensions_A=[32, 32 * tile_cnt],
+        stimuli_format_B=formats.input_format,
+        input_dimensions_B=[32, 32 * tile_cnt],
+    )
+
+    configuration = TestConfig(
+        "sources/unpack_A_paged_test.cpp",
+        formats,
+        templates=[PAGE_TABLE(page_order, log2_tiles_per_page)],
+        runtimes=[TILE_COUNT(tile_cnt)],
+        variant_stimuli=StimuliConfig(
+            scatter_pages(src_A, page_order, tiles_per_page),
+            formats.input_format,
+            src_B,
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=tile_cnt,
+            tile_count_B=tile_cnt,
+            tile_count_res=tile_cnt,
+            buffer_C=page_table_tile(),
+            stimuli_C_format=formats.input_format,
+            tile_count_C=1,
+        ),
+        dest_acc=DestAccumulation.No,
+    )
+
+    res_from_L1 = configuration.run(workers_tensix_coordinates).result
+    res_tensor = torch.tensor(res_from_L1, dtype=format_dict[formats.output_format])
+
+    # Tiles come back in logical order
+    assert passed_test(
+        src_A.to(format_dict[formats.output_format]), res_tensor, formats.output_format
+    ), "Assert against golden failed"
+
+
+@parametrize(
+    formats=input_output_formats([DataFormat.Float16_b], same=True),
+    # In0 reuses input 0 and runs the unpack MOP page by page over input 1, In1 resolves
+    # every input 1 tile address on the TRISC
+    reuse=[MatmulReuse.In0, MatmulReuse.In1],
+    log2_tiles_per_page=[0, 1],
+)
+def test_unpack_matmul_paged(
+    formats, reuse, log2_tiles_per_page, workers_tensix_coordinates
+):
+    # ct_dim = 3 with two-tile pages puts every row of input 1 across a page boundary
+    input_A_dimensions = [64, 64]
+    input_B_dimensions = [64, 96]
+    matmul_dims = generate_tile_dims((input_A_dimensions, input_B_dimensions))
+    tiles_per_page = 1 << log2_tiles_per_page
+    tile_cnt_B = matmul_dims.kt_dim * matmul_dims.ct_dim
+    page_order = shuffled_page_order(tile_cnt_B // tiles_per_page)
+
+    src_A, tile_cnt_A, src_B, _ = generate_stimuli(
+        stimuli_format_A=formats.input_format,
+        input_dimensions_A=input_A_dimensions,
+        stimuli_format_B=formats.input_format,
+        input_dimensions_B=input_B_dimensions,
+        sfpu=False,
+    )
+
+    generate_golden = get_golden_generator(MatmulGolden)
+    golden_tensor = generate_golden(
+        src_A,
+        src_B,
+        formats.output_format,
+        MathFidelity.HiFi4,
+        input_A_dimensions=input_A_dimensions,
+        input_B_dimensions=input_B_dimensions,
+        tilize=True,
+    )
+
+    tilized_A = tilize_block(
+        src_A, dimensions=input_A_dimensions, stimuli_format=formats.input_format
+    )
+    tilized_B = tilize_block(
+        src_B, dimensions=input_B_dimensions, stimuli_format=formats.input_format
+    )
+
+    configuration = TestConfig(
+        "sources/unpack_matmul_paged_test.cpp",
+        formats,
+        templates=[
+            MATH_FIDELITY(MathFidelity.HiFi4),
+            MATMUL_REUSE(reuse),
+            PAGE_TABLE(page_order, log2_tiles_per_page),
+        ],
+        runtimes=[
+            TILE_COUNT(matmul_dims.output_tile_cnt),
+            CRK_TILE_DIMM(matmul_dims.ct_dim, matmul_dims.rt_dim, matmul_dims.kt_dim),
+        ],
+        variant_stimuli=StimuliConfig(
+            tilized_A.flatten(),
+            formats.input_format,
+            scatter_pages(tilized_B.flatten(), page_order, tiles_per_page),
+            formats.input_format,
+            formats.output_format,
+            tile_count_A=tile_cnt_A,
+            tile_count_B=tile_cnt_B,
+            tile_count_res=matmul_dims.output_tile_cnt,
+            buffer_C=page_table_tile(),
+            stimuli_C_format=formats.input_format,
+            tile_count_C=1,
+        ),
+        dest_acc=DestAccumulation.No,
+    )
+
+    res_from_L1 = configuration.run(workers_tensix_coordinates).result
+    assert len(res_from_L1) == len(golden_tensor)
+    res_tensor = torch.tensor(res_from_L1, dtype=format_dict[formats.output_format])
+
+    assert passed_test(
+        golden_tensor, res_tensor, formats.output_format
+    ), "Assert against golden failed"
@@ -0,0 +1,77 @@
+// SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdint>
+
+#include "ckernel.h"
+#include "llk_defs.h"
+#include "params.h"
+
+// Globals
+std::uint32_t unp_cfg_context          = 0;
+std::uint32_t pack_sync_tile_dst_ptr   = 0;
+std::uint32_t math_sync_tile_dst_index = 0;
+
+#ifdef LLK_TRISC_UNPACK
+
+#include "llk_unpack_common.h"
+#include "llk_unpack_convert_tiles.h"
+
+void run_kernel(const volatile struct RuntimeParams *params)
+{
+    _llk_unpack_hw_configure_<is_fp32_dest_acc_en>(
+        formats.unpack_A_src, formats.unpack_B_src, formats.unpack_A_dst, formats.unpack_B_dst, FACE_R_DIM, FACE_R_DIM, params->num_faces, params->num_faces);
+    _llk_unpack_convert_tiles_init_(formats.unpack_A_src, formats.unpack_A_dst, FACE_R_DIM, params->num_faces, params->TILE_CNT);
+
+    // The whole block goes to dest with a single context acquire
+    _llk_unpack_convert_tiles_(L1_ADDRESS(params->buffer_A[0]), formats.unpack_A_src, formats.unpack_A_dst);
+}
+
+#endif
+
+#ifdef LLK_TRISC_MATH
+
+#include "llk_math_common.h"
+#include "llk_math_convert_tiles.h"
+
+using namespace ckernel;
+
+void run_kernel(const volatile struct RuntimeParams *params)
+{
+    _llk_math_pack_sync_init_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+    _llk_math_hw_configure_<is_fp32_dest_acc_en>(formats.math, formats.math);
+    _llk_math_convert_tiles_init_();
+
+    _llk_math_wait_for_dest_available_<DstSync::SyncHalf>();
+    _llk_math_convert_tiles_<DstSync::SyncHalf, is_fp32_dest_acc_en>(0, params->TILE_CNT, params->num_faces);
+    _llk_math_dest_section_done_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+}
+
+#endif
+
+#ifdef LLK_TRISC_PACK
+
+#include "llk_pack.h"
+#include "llk_pack_common.h"
+
+void run_kernel(const volatile struct RuntimeParams *params)
+{
+#ifdef ARCH_BLACKHOLE
+    _llk_pack_hw_configure_<is_fp32_dest_acc_en, false, false>(formats.pack_src, formats.pack_dst, 16 * 16 * 4, FACE_R_DIM, TILE_C_DIM, params->num_faces);
+    _llk_pack_init_<false, false, false>(formats.pack_dst, FACE_R_DIM, TILE_C_DIM, params->num_faces);
+    _llk_pack_dest_init_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+#else
+    _llk_pack_hw_configure_<is_fp32_dest_acc_en, false>(formats.pack_src, formats.pack_dst, 16 * 16 * 4, FACE_R_DIM, params->num_faces);
+    _llk_pack_init_<false, false>(formats.pack_dst, FACE_R_DIM, params->num_faces);
+    _llk_pack_dest_init_<DstSync::SyncHalf, is_fp32_dest_acc_en, false>();
+#endif
+
+    _llk_packer_wait_for_math_done_();
+    for (int i = 0; i < params->TILE_CNT; ++i)
+    {
+        _llk_pack_<DstSync::SyncHalf, is_fp32_dest_acc_en, false>(i, L1_ADDRESS(params->buffer_Res[i]));
+    }
+    _llk_pack_dest_section_done_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+}
+#endif
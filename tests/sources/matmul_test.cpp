@@ -34,10 +34,10 @@ void run_kernel(const volatile struct RuntimeParams *params)
         params->num_faces_B,
         TILE_SIZE_UNPACK_A,
         TILE_SIZE_UNPACK_B);
-    _llk_unpack_AB_matmul_init_<>(0, params->CT_DIM, params->RT_DIM, params->KT_DIM, FACE_R_DIM, FACE_R_DIM, 4, 4, false, false);
+    _llk_unpack_AB_matmul_init_<0, 0, MATMUL_REUSE>(0, params->CT_DIM, params->RT_DIM, params->KT_DIM, FACE_R_DIM, FACE_R_DIM, 4, 4, false, false);
     for (std::uint32_t j = 0; j < params->KT_DIM; j++)
     {
-        _llk_unpack_AB_matmul_<>(
+        _llk_unpack_AB_matmul_<0, 0, MATMUL_REUSE>(
             L1_ADDRESS(params->buffer_A[0]),
             L1_ADDRESS(params->buffer_B[0]),
             j,
@@ -62,7 +62,7 @@ void run_kernel(const volatile struct RuntimeParams *params)
 
 void run_kernel(const volatile struct RuntimeParams *params)
 {
-    _llk_math_matmul_init_<MATH_FIDELITY>(TILE_R_DIM, TILE_C_DIM, TILE_R_DIM, TILE_C_DIM, false, 0, params->CT_DIM, params->RT_DIM);
+    _llk_math_matmul_init_<MATH_FIDELITY, 0, MATMUL_REUSE>(TILE_R_DIM, TILE_C_DIM, TILE_R_DIM, TILE_C_DIM, false, 0, params->CT_DIM, params->RT_DIM);
     _llk_math_pack_sync_init_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
     _llk_math_hw_configure_<is_fp32_dest_acc_en>(formats.math, formats.math);
 
@@ -74,7 +74,7 @@ void run_kernel(const volatile struct RuntimeParams *params)
     _llk_math_wait_for_dest_available_<DstSync::SyncHalf>();
     for (std::uint32_t j = 0; j < params->KT_DIM; j++)
     {
-        _llk_math_matmul_<MATH_FIDELITY>(0, params->CT_DIM, params->RT_DIM);
+        _llk_math_matmul_<MATH_FIDELITY, 0, MATMUL_REUSE>(0, params->CT_DIM, params->RT_DIM);
     }
     _llk_math_dest_section_done_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
 }
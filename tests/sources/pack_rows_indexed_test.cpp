@@ -0,0 +1,132 @@
+// SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdint>
+
+#include "ckernel.h"
+#include "llk_defs.h"
+
+// Globals
+std::uint32_t unp_cfg_context          = 0;
+std::uint32_t pack_sync_tile_dst_ptr   = 0;
+std::uint32_t math_sync_tile_dst_index = 0;
+
+#ifdef LLK_TRISC_UNPACK
+
+#include "llk_unpack_A.h"
+#include "llk_unpack_common.h"
+#include "params.h"
+
+void run_kernel(const volatile struct RuntimeParams *params)
+{
+    _llk_unpack_hw_configure_<is_fp32_dest_acc_en>(
+        formats.unpack_A_src, formats.unpack_B_src, formats.unpack_A_dst, formats.unpack_B_dst, FACE_R_DIM, FACE_R_DIM, 4 /*num_faces*/, 4 /*num_faces*/);
+    _llk_unpack_A_init_<BroadcastType::NONE, false /*acc_to_dest*/, EltwiseBinaryReuseDestType::NONE, unpack_to_dest>(
+        0 /*transpose_of_faces*/, 0 /*within_face_16x16_transpose*/, FACE_R_DIM, 4 /*num_faces*/, formats.unpack_A_src, formats.unpack_A_dst);
+    for (int i = 0; i < params->TILE_CNT; ++i)
+    {
+        _llk_unpack_A_<BroadcastType::NONE, false, EltwiseBinaryReuseDestType::NONE, unpack_to_dest>(
+            L1_ADDRESS(params->buffer_A[i]), formats.unpack_A_src, formats.unpack_A_dst);
+    }
+}
+
+#endif
+
+#ifdef LLK_TRISC_MATH
+
+#include "llk_math_common.h"
+#include "llk_math_eltwise_unary_datacopy.h"
+#include "params.h"
+
+using namespace ckernel;
+
+void run_kernel(const volatile struct RuntimeParams *params)
+{
+    const bool is_int_fpu_en = false;
+
+    _llk_math_hw_configure_<is_fp32_dest_acc_en>(formats.math, formats.math);
+#ifdef ARCH_BLACKHOLE
+    _llk_math_eltwise_unary_datacopy_init_<DataCopyType::A2D, is_fp32_dest_acc_en, BroadcastType::NONE, false, is_int_fpu_en>(4 /*num_faces*/, formats.math);
+#else
+    _llk_math_eltwise_unary_datacopy_init_<DataCopyType::A2D, is_fp32_dest_acc_en, BroadcastType::NONE, is_int_fpu_en>(4 /*num_faces*/, formats.math);
+#endif
+    _llk_math_pack_sync_init_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+    _llk_math_wait_for_dest_available_<DstSync::SyncHalf>();
+    for (int i = 0; i < params->TILE_CNT; ++i)
+    {
+        LLK_ASSERT(
+            (i < get_dest_max_tiles<DstSync::SyncHalf, is_fp32_dest_acc_en, DstTileShape::Tile32x32>()), "Block tile index exceeds maximum destination tiles");
+        _llk_math_eltwise_unary_datacopy_<DataCopyType::A2D, DstSync::SyncHalf, is_fp32_dest_acc_en, BroadcastType::NONE, unpack_to_dest>(
+            i, formats.math, formats.math);
+    }
+    _llk_math_dest_section_done_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+}
+
+#endif
+
+#ifdef LLK_TRISC_PACK
+
+#include "llk_pack.h"
+#include "llk_pack_common.h"
+#include "llk_pack_rows.h"
+#include "params.h"
+
+// Every row unit of the tile once, in order
+constexpr std::array<std::uint32_t, 64 / PACK_ROWS_PER_INDEX> PACK_ROWS_BASE_INDICES = []
+{
+    std::array<std::uint32_t, 64 / PACK_ROWS_PER_INDEX> indices {};
+    for (std::uint32_t i = 0; i < indices.size(); i++)
+    {
+        indices[i] = i;
+    }
+    return indices;
+}();
+
+void run_kernel(const volatile struct RuntimeParams *params)
+{
+    const bool UNTILIZE = false;
+
+    _llk_pack_hw_configure_<is_fp32_dest_acc_en, UNTILIZE>(formats.pack_src, formats.pack_dst, FACE_R_DIM * FACE_C_DIM * TILE_NUM_FACES);
+#ifdef ARCH_BLACKHOLE
+    _llk_pack_dest_init_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+#else
+    _llk_pack_dest_init_<DstSync::SyncHalf, is_fp32_dest_acc_en, UNTILIZE>();
+#endif
+    _llk_pack_rows_init_(PACK_ROWS_PER_INDEX);
+    _llk_packer_wait_for_math_done_();
+
+    for (int i = 0; i < params->TILE_CNT; ++i)
+    {
+        LLK_ASSERT(
+            (i < get_dest_max_tiles<DstSync::SyncHalf, is_fp32_dest_acc_en, DstTileShape::Tile32x32>()), "Block tile index exceeds maximum destination tiles");
+        if constexpr (PACK_ROWS_SCATTER_ADD)
+        {
+            // The tile's rows in order are the base the indexed rows accumulate onto
+            _llk_pack_rows_scatter_(
+                i, L1_ADDRESS(params->buffer_Res[i]), PACK_ROWS_BASE_INDICES.data(), PACK_ROWS_BASE_INDICES.size(), PACK_ROWS_PER_INDEX, formats.pack_dst);
+
+            // Waiting for the packer before the reconfiguration also orders the two calls, which hit the same rows
+            TTI_STALLWAIT(p_stall::STALL_CFG, p_stall::PACK);
+            _llk_pack_reconfig_l1_acc_(1);
+            _llk_pack_rows_scatter_(
+                i, L1_ADDRESS(params->buffer_Res[i]), PACK_ROWS_INDICES.data(), PACK_ROWS_INDICES.size(), PACK_ROWS_PER_INDEX, formats.pack_dst);
+            TTI_STALLWAIT(p_stall::STALL_CFG, p_stall::PACK);
+            _llk_pack_reconfig_l1_acc_(0);
+        }
+        else if constexpr (PACK_ROWS_SCATTER)
+        {
+            _llk_pack_rows_scatter_(
+                i, L1_ADDRESS(params->buffer_Res[i]), PACK_ROWS_INDICES.data(), PACK_ROWS_INDICES.size(), PACK_ROWS_PER_INDEX, formats.pack_dst);
+        }
+        else
+        {
+            _llk_pack_rows_gather_(
+                i, L1_ADDRESS(params->buffer_Res[i]), PACK_ROWS_INDICES.data(), PACK_ROWS_INDICES.size(), PACK_ROWS_PER_INDEX, formats.pack_dst);
+        }
+    }
+    _llk_pack_rows_uninit_();
+    _llk_pack_dest_section_done_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+}
+
+#endif
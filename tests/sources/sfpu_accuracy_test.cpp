@@ -0,0 +1,173 @@
+// SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdint>
+
+#include "ckernel.h"
+#include "ckernel_defs.h"
+#include "llk_defs.h"
+#include "params.h"
+
+// Globals
+std::uint32_t unp_cfg_context          = 0;
+std::uint32_t pack_sync_tile_dst_ptr   = 0;
+std::uint32_t math_sync_tile_dst_index = 0;
+
+#ifdef LLK_TRISC_UNPACK
+
+#include "llk_unpack_A.h"
+#include "llk_unpack_common.h"
+
+void run_kernel(const volatile struct RuntimeParams *params)
+{
+    _llk_unpack_hw_configure_<is_fp32_dest_acc_en>(
+        formats.unpack_A_src, formats.unpack_B_src, formats.unpack_A_dst, formats.unpack_B_dst, FACE_R_DIM, FACE_R_DIM, 4 /* num_faces */, 4 /* num_faces */);
+    _llk_unpack_A_init_<BroadcastType::NONE, false, EltwiseBinaryReuseDestType::NONE, unpack_to_dest>(
+        0, 0, FACE_R_DIM, 4, formats.unpack_A_src, formats.unpack_A_dst);
+
+    _llk_unpack_A_<BroadcastType::NONE, false, EltwiseBinaryReuseDestType::NONE, unpack_to_dest>(
+        L1_ADDRESS(params->buffer_A[0]), formats.unpack_A_src, formats.unpack_A_dst);
+}
+
+#endif
+
+#ifdef LLK_TRISC_MATH
+
+#include "ckernel_sfpu.h"
+#include "llk_math_common.h"
+#include "llk_math_eltwise_unary_datacopy.h"
+#include "llk_math_eltwise_unary_sfpu_params.h"
+
+using namespace ckernel;
+using namespace ckernel::sfpu;
+
+// The tier polynomials come out of the compile-time Remez fitter, so it is checked against known minimax errors here,
+// whenever this kernel is built.
+struct MinimaxCube
+{
+    static constexpr bool RELATIVE = false;
+
+    static constexpr double eval(const double x)
+    {
+        return x * x * x;
+    }
+};
+
+struct MinimaxExpAbsolute
+{
+    static constexpr bool RELATIVE = false;
+
+    static constexpr double eval(const double x)
+    {
+        return internal::cx_exp(x);
+    }
+};
+
+// The best quadratic to x^3 on [-1, 1] is x^3 - T_3(x) / 4 = 3x / 4, off by exactly 1/4 at the extrema of T_3, which
+// all lie on the grid
+constexpr MinimaxFit<2> CUBE_FIT = minimax_fit<MinimaxCube, 2>(-1.0, 1.0);
+static_assert(internal::cx_abs(CUBE_FIT.max_error - 0.25) < 1e-9, "Minimax error of x^3 by a quadratic must be 1/4");
+static_assert(internal::cx_abs(CUBE_FIT.coefficients[0]) < 1e-9 && internal::cx_abs(CUBE_FIT.coefficients[1] - 0.75) < 1e-9, "Expected 3x / 4");
+static_assert(internal::cx_abs(CUBE_FIT.coefficients[2]) < 1e-9, "Expected 3x / 4");
+static_assert(minimax_degree<MinimaxCube>(-1.0, 1.0, 1e-9) == 3, "x^3 is fitted exactly from degree 3");
+
+// The best line to exp on [-1, 1] touches it at log(sinh(1)), with error (1/e + sinh(1) * log(sinh(1))) / 2; the grid
+// misses the tangent point by at most half a step
+constexpr MinimaxFit<1> EXP_LINE_FIT = minimax_fit<MinimaxExpAbsolute, 1>(-1.0, 1.0);
+static_assert(internal::cx_abs(EXP_LINE_FIT.max_error - 0.2788015857955023) < 1e-5, "Minimax error of exp by a line on [-1, 1]");
+
+void run_kernel(const volatile struct RuntimeParams *)
+{
+#ifdef ARCH_BLACKHOLE
+    _llk_math_eltwise_unary_datacopy_init_<DataCopyType::A2D, is_fp32_dest_acc_en, BroadcastType::NONE, false, false>(4, formats.math);
+#else
+    _llk_math_eltwise_unary_datacopy_init_<DataCopyType::A2D, is_fp32_dest_acc_en, BroadcastType::NONE, false>(4, formats.math);
+#endif
+    _llk_math_pack_sync_init_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+    _llk_math_hw_configure_<is_fp32_dest_acc_en>(formats.math, formats.math);
+    _llk_math_wait_for_dest_available_<DstSync::SyncHalf>();
+    _llk_math_eltwise_unary_datacopy_<DataCopyType::A2D, DstSync::SyncHalf, is_fp32_dest_acc_en, BroadcastType::NONE, unpack_to_dest>(
+        0, formats.math, formats.math);
+
+    _llk_math_eltwise_unary_sfpu_init_<SFPU_UNARY_OPERATION>();
+
+    // The same kernel is built once per accuracy tier; only SFPU_ACCURACY changes between variants
+    if constexpr (SFPU_UNARY_OPERATION == SfpuType::exponential)
+    {
+        _init_exponential_tiered_<SFPU_ACCURACY>();
+        _llk_math_eltwise_unary_sfpu_params_<false>(_calculate_exponential_tiered_<SFPU_ACCURACY, 8>, 0);
+    }
+    else if constexpr (SFPU_UNARY_OPERATION == SfpuType::reciprocal)
+    {
+        _init_reciprocal_tiered_<SFPU_ACCURACY>();
+        _llk_math_eltwise_unary_sfpu_params_<false>(_calculate_reciprocal_tiered_<SFPU_ACCURACY, 8>, 0);
+    }
+    else if constexpr (SFPU_UNARY_OPERATION == SfpuType::sqrt)
+    {
+        _init_sqrt_tiered_<SFPU_ACCURACY>();
+        _llk_math_eltwise_unary_sfpu_params_<false>(_calculate_sqrt_tiered_<SFPU_ACCURACY, 8>, 0);
+    }
+    else if constexpr (SFPU_UNARY_OPERATION == SfpuType::rsqrt)
+    {
+        _init_rsqrt_tiered_<SFPU_ACCURACY>();
+        _llk_math_eltwise_unary_sfpu_params_<false>(_calculate_rsqrt_tiered_<SFPU_ACCURACY, 8>, 0);
+    }
+    else if constexpr (SFPU_UNARY_OPERATION == SfpuType::tanh)
+    {
+        _init_tanh_tiered_<SFPU_ACCURACY>();
+        _llk_math_eltwise_unary_sfpu_params_<false>(_calculate_tanh_tiered_<SFPU_ACCURACY, 8>, 0);
+    }
+    else if constexpr (SFPU_UNARY_OPERATION == SfpuType::sigmoid)
+    {
+        _init_sigmoid_tiered_<SFPU_ACCURACY>();
+        _llk_math_eltwise_unary_sfpu_params_<false>(_calculate_sigmoid_tiered_<SFPU_ACCURACY, 8>, 0);
+    }
+    else if constexpr (SFPU_UNARY_OPERATION == SfpuType::silu)
+    {
+        _init_silu_tiered_<SFPU_ACCURACY>();
+        _llk_math_eltwise_unary_sfpu_params_<false>(_calculate_silu_tiered_<SFPU_ACCURACY, 8>, 0);
+    }
+    else if constexpr (SFPU_UNARY_OPERATION == SfpuType::elu)
+    {
+        _init_elu_tiered_<SFPU_ACCURACY>();
+        _llk_math_eltwise_unary_sfpu_params_<false>(_calculate_elu_tiered_<SFPU_ACCURACY, 8>, 0);
+    }
+    else if constexpr (SFPU_UNARY_OPERATION == SfpuType::gelu)
+    {
+        _init_gelu_tiered_<SFPU_ACCURACY>();
+        _llk_math_eltwise_unary_sfpu_params_<false>(_calculate_gelu_tiered_<SFPU_ACCURACY, 8>, 0);
+    }
+
+    _llk_math_dest_section_done_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+}
+
+#endif
+
+#ifdef LLK_TRISC_PACK
+
+#include "llk_pack.h"
+#include "llk_pack_common.h"
+
+void run_kernel(const volatile struct RuntimeParams *params)
+{
+#ifdef ARCH_BLACKHOLE
+    _llk_pack_hw_configure_<is_fp32_dest_acc_en, false, false>(formats.pack_src, formats.pack_dst, 16 * 16 * 4);
+#else
+    _llk_pack_hw_configure_<is_fp32_dest_acc_en, false>(formats.pack_src, formats.pack_dst, 16 * 16 * 4);
+#endif
+
+    _llk_pack_init_<false, false>(formats.pack_dst);
+
+#ifdef ARCH_BLACKHOLE
+    _llk_pack_dest_init_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+#else
+    _llk_pack_dest_init_<DstSync::SyncHalf, is_fp32_dest_acc_en, false>();
+#endif
+
+    _llk_packer_wait_for_math_done_();
+    _llk_pack_<DstSync::SyncHalf, is_fp32_dest_acc_en, false>(0, L1_ADDRESS(params->buffer_Res[0]));
+    _llk_pack_dest_section_done_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+}
+
+#endif
@@ -0,0 +1,116 @@
+// SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdint>
+
+#include "ckernel.h"
+#include "ckernel_defs.h"
+#include "llk_defs.h"
+#include "params.h"
+
+// Globals
+std::uint32_t unp_cfg_context          = 0;
+std::uint32_t pack_sync_tile_dst_ptr   = 0;
+std::uint32_t math_sync_tile_dst_index = 0;
+
+#ifdef LLK_TRISC_UNPACK
+
+#include "llk_unpack_A.h"
+#include "llk_unpack_common.h"
+
+void run_kernel(const volatile struct RuntimeParams *params)
+{
+    _llk_unpack_hw_configure_<is_fp32_dest_acc_en>(
+        formats.unpack_A_src, formats.unpack_B_src, formats.unpack_A_dst, formats.unpack_B_dst, FACE_R_DIM, FACE_R_DIM, 4 /* num_faces */, 4 /* num_faces */);
+    _llk_unpack_A_init_<BroadcastType::NONE, false, EltwiseBinaryReuseDestType::NONE, unpack_to_dest>(
+        0, 0, FACE_R_DIM, 4, formats.unpack_A_src, formats.unpack_A_dst);
+
+    // The input and operand tiles land in dest tiles 0 and 1
+    _llk_unpack_A_<BroadcastType::NONE, false, EltwiseBinaryReuseDestType::NONE, unpack_to_dest>(
+        L1_ADDRESS(params->buffer_A[0]), formats.unpack_A_src, formats.unpack_A_dst);
+    _llk_unpack_A_<BroadcastType::NONE, false, EltwiseBinaryReuseDestType::NONE, unpack_to_dest>(
+        L1_ADDRESS(params->buffer_B[0]), formats.unpack_A_src, formats.unpack_A_dst);
+}
+
+#endif
+
+#ifdef LLK_TRISC_MATH
+
+#include "ckernel_sfpu.h"
+#include "llk_math_common.h"
+#include "llk_math_eltwise_binary_sfpu_params.h"
+#include "llk_math_eltwise_unary_datacopy.h"
+#include "llk_math_eltwise_unary_sfpu_params.h"
+
+using namespace ckernel;
+using namespace ckernel::sfpu;
+
+// fp32 bits of the scalar operand, 3.0f; test_sfpu_binary_bcast.py uses the same value
+constexpr std::uint32_t BCAST_SCALAR = 0x40400000;
+
+void run_kernel(const volatile struct RuntimeParams *)
+{
+#ifdef ARCH_BLACKHOLE
+    _llk_math_eltwise_unary_datacopy_init_<DataCopyType::A2D, is_fp32_dest_acc_en, BroadcastType::NONE, false, false>(4, formats.math);
+#else
+    _llk_math_eltwise_unary_datacopy_init_<DataCopyType::A2D, is_fp32_dest_acc_en, BroadcastType::NONE, false>(4, formats.math);
+#endif
+    _llk_math_pack_sync_init_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+    _llk_math_hw_configure_<is_fp32_dest_acc_en>(formats.math, formats.math);
+    _llk_math_wait_for_dest_available_<DstSync::SyncHalf>();
+    for (std::uint32_t i = 0; i < 2; i++)
+    {
+        _llk_math_eltwise_unary_datacopy_<DataCopyType::A2D, DstSync::SyncHalf, is_fp32_dest_acc_en, BroadcastType::NONE, unpack_to_dest>(
+            i, formats.math, formats.math);
+    }
+
+    _llk_math_eltwise_binary_sfpu_init_<SfpuType::add1>();
+    _sfpu_binary_init_<APPROX_MODE, SFPU_BINARY_OPERATION>();
+
+    if constexpr (BROADCAST_TYPE == BroadcastType::SCALAR)
+    {
+        _llk_math_eltwise_unary_sfpu_params_<APPROX_MODE>(
+            _calculate_sfpu_binary_scalar_<APPROX_MODE, SFPU_BINARY_OPERATION>, 0, static_cast<int>(VectorMode::RC), BCAST_SCALAR);
+    }
+    else
+    {
+        // Prepared once; every further input tile would reuse dest tile 1 as is
+        _llk_math_eltwise_unary_sfpu_params_<APPROX_MODE>(
+            _calculate_sfpu_binary_bcast_prepare_<APPROX_MODE, SFPU_BINARY_OPERATION, BROADCAST_TYPE>, 0, static_cast<int>(VectorMode::None), 1);
+        _llk_math_eltwise_binary_sfpu_params_<APPROX_MODE>(
+            _calculate_sfpu_binary_bcast_<APPROX_MODE, SFPU_BINARY_OPERATION, BROADCAST_TYPE>, 0, 1, 0, static_cast<int>(VectorMode::None));
+    }
+
+    _llk_math_dest_section_done_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+}
+
+#endif
+
+#ifdef LLK_TRISC_PACK
+
+#include "llk_pack.h"
+#include "llk_pack_common.h"
+
+void run_kernel(const volatile struct RuntimeParams *params)
+{
+#ifdef ARCH_BLACKHOLE
+    _llk_pack_hw_configure_<is_fp32_dest_acc_en, false, false>(formats.pack_src, formats.pack_dst, 16 * 16 * 4);
+#else
+    _llk_pack_hw_configure_<is_fp32_dest_acc_en, false>(formats.pack_src, formats.pack_dst, 16 * 16 * 4);
+#endif
+
+    _llk_pack_init_<false, false>(formats.pack_dst);
+
+#ifdef ARCH_BLACKHOLE
+    _llk_pack_dest_init_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+#else
+    _llk_pack_dest_init_<DstSync::SyncHalf, is_fp32_dest_acc_en, false>();
+#endif
+
+    _llk_packer_wait_for_math_done_();
+    _llk_pack_<DstSync::SyncHalf, is_fp32_dest_acc_en, false>(0, L1_ADDRESS(params->buffer_Res[0]));
+    _llk_pack_dest_section_done_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+}
+
+#endif
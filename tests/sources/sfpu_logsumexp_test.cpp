@@ -0,0 +1,138 @@
+// SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdint>
+
+#include "ckernel.h"
+#include "ckernel_defs.h"
+#include "llk_defs.h"
+#include "params.h"
+
+// Globals
+std::uint32_t unp_cfg_context          = 0;
+std::uint32_t pack_sync_tile_dst_ptr   = 0;
+std::uint32_t math_sync_tile_dst_index = 0;
+
+// Mirrored in test_sfpu_logsumexp.py. Input tiles: the logits of one tile row, the target class indices and a tile of
+// garbage unpacked into the state tile, which the first accumulate must not read. The results need more than the four
+// fp32 tiles of a half dest, so the whole test runs in full sync.
+constexpr std::uint32_t NUM_COL_TILES  = 3;
+constexpr std::uint32_t TARGET_TILE    = NUM_COL_TILES;
+constexpr std::uint32_t STATE_TILE     = NUM_COL_TILES + 1;
+constexpr std::uint32_t OUT_TILE       = NUM_COL_TILES + 2;
+constexpr std::uint32_t NUM_IN_TILES   = NUM_COL_TILES + 2;
+constexpr std::uint32_t TILE_COL_WIDTH = 32;
+
+#ifdef LLK_TRISC_UNPACK
+
+#include "llk_unpack_A.h"
+#include "llk_unpack_common.h"
+
+void run_kernel(const volatile struct RuntimeParams *params)
+{
+    _llk_unpack_hw_configure_<is_fp32_dest_acc_en>(
+        formats.unpack_A_src, formats.unpack_B_src, formats.unpack_A_dst, formats.unpack_B_dst, FACE_R_DIM, FACE_R_DIM, 4 /* num_faces */, 4 /* num_faces */);
+    _llk_unpack_A_init_<BroadcastType::NONE, false, EltwiseBinaryReuseDestType::NONE, unpack_to_dest>(
+        0, 0, FACE_R_DIM, 4, formats.unpack_A_src, formats.unpack_A_dst);
+
+    for (std::uint32_t i = 0; i < NUM_IN_TILES; i++)
+    {
+        _llk_unpack_A_<BroadcastType::NONE, false, EltwiseBinaryReuseDestType::NONE, unpack_to_dest>(
+            L1_ADDRESS(params->buffer_A[i]), formats.unpack_A_src, formats.unpack_A_dst);
+    }
+}
+
+#endif
+
+#ifdef LLK_TRISC_MATH
+
+#include "ckernel_sfpu.h"
+#include "llk_math_common.h"
+#include "llk_math_eltwise_unary_datacopy.h"
+#include "llk_math_eltwise_unary_sfpu_params.h"
+
+using namespace ckernel;
+using namespace ckernel::sfpu;
+
+void run_kernel(const volatile struct RuntimeParams *params)
+{
+#ifdef ARCH_BLACKHOLE
+    _llk_math_eltwise_unary_datacopy_init_<DataCopyType::A2D, is_fp32_dest_acc_en, BroadcastType::NONE, false, false>(4, formats.math);
+#else
+    _llk_math_eltwise_unary_datacopy_init_<DataCopyType::A2D, is_fp32_dest_acc_en, BroadcastType::NONE, false>(4, formats.math);
+#endif
+    _llk_math_pack_sync_init_<DstSync::SyncFull, is_fp32_dest_acc_en>();
+    _llk_math_hw_configure_<is_fp32_dest_acc_en>(formats.math, formats.math);
+    _llk_math_wait_for_dest_available_<DstSync::SyncFull>();
+
+    for (std::uint32_t i = 0; i < NUM_IN_TILES; i++)
+    {
+        _llk_math_eltwise_unary_datacopy_<DataCopyType::A2D, DstSync::SyncFull, is_fp32_dest_acc_en, BroadcastType::NONE, unpack_to_dest>(
+            i, formats.math, formats.math);
+    }
+
+    _llk_math_eltwise_unary_sfpu_init_<SfpuType::unused>();
+    _init_logsumexp_<APPROX_MODE>();
+
+    for (std::uint32_t c = 0; c < NUM_COL_TILES; c++)
+    {
+        _llk_math_eltwise_unary_sfpu_params_<APPROX_MODE>(
+            _calculate_logsumexp_accumulate_<APPROX_MODE, NLL_EN>,
+            0,
+            static_cast<int>(VectorMode::None),
+            c,
+            STATE_TILE,
+            c == 0,
+            TARGET_TILE,
+            c * TILE_COL_WIDTH);
+    }
+    _llk_math_eltwise_unary_sfpu_params_<APPROX_MODE>(
+        _calculate_logsumexp_finalize_<APPROX_MODE, NLL_EN>, 0, static_cast<int>(VectorMode::None), STATE_TILE, OUT_TILE);
+
+    // Log-probabilities overwrite the logits
+    if constexpr (!NLL_EN)
+    {
+        for (std::uint32_t c = 0; c < NUM_COL_TILES; c++)
+        {
+            _llk_math_eltwise_unary_sfpu_params_<APPROX_MODE>(_calculate_log_softmax_<APPROX_MODE>, 0, static_cast<int>(VectorMode::RC), c, OUT_TILE, c);
+        }
+    }
+
+    _llk_math_dest_section_done_<DstSync::SyncFull, is_fp32_dest_acc_en>();
+}
+
+#endif
+
+#ifdef LLK_TRISC_PACK
+
+#include "llk_pack.h"
+#include "llk_pack_common.h"
+
+void run_kernel(const volatile struct RuntimeParams *params)
+{
+#ifdef ARCH_BLACKHOLE
+    _llk_pack_hw_configure_<is_fp32_dest_acc_en, false, false>(formats.pack_src, formats.pack_dst, 16 * 16 * 4);
+#else
+    _llk_pack_hw_configure_<is_fp32_dest_acc_en, false>(formats.pack_src, formats.pack_dst, 16 * 16 * 4);
+#endif
+
+    _llk_pack_init_<false, false>(formats.pack_dst);
+
+#ifdef ARCH_BLACKHOLE
+    _llk_pack_dest_init_<DstSync::SyncFull, is_fp32_dest_acc_en>();
+#else
+    _llk_pack_dest_init_<DstSync::SyncFull, is_fp32_dest_acc_en, false>();
+#endif
+
+    // The logits (log-probabilities without NLL_EN), then the logsumexp or loss tile
+    _llk_packer_wait_for_math_done_();
+    for (std::uint32_t c = 0; c < NUM_COL_TILES; c++)
+    {
+        _llk_pack_<DstSync::SyncFull, is_fp32_dest_acc_en, false>(c, L1_ADDRESS(params->buffer_Res[c]));
+    }
+    _llk_pack_<DstSync::SyncFull, is_fp32_dest_acc_en, false>(OUT_TILE, L1_ADDRESS(params->buffer_Res[NUM_COL_TILES]));
+    _llk_pack_dest_section_done_<DstSync::SyncFull, is_fp32_dest_acc_en>();
+}
+
+#endif
@@ -0,0 +1,144 @@
+// SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdint>
+
+#include "ckernel.h"
+#include "ckernel_defs.h"
+#include "llk_defs.h"
+#include "params.h"
+
+// Globals
+std::uint32_t unp_cfg_context          = 0;
+std::uint32_t pack_sync_tile_dst_ptr   = 0;
+std::uint32_t math_sync_tile_dst_index = 0;
+
+// Mirrored in test_sfpu_softmax_exp.py: 1/sqrt(d_k) for d_k = 64. SOFTMAX_SOFTCAP comes with SOFTCAP_EN.
+constexpr float SOFTMAX_SCALE = 0.125f;
+
+#ifdef LLK_TRISC_UNPACK
+
+#include "llk_unpack_A.h"
+#include "llk_unpack_common.h"
+
+void run_kernel(const volatile struct RuntimeParams *params)
+{
+    _llk_unpack_hw_configure_<is_fp32_dest_acc_en>(
+        formats.unpack_A_src, formats.unpack_B_src, formats.unpack_A_dst, formats.unpack_B_dst, FACE_R_DIM, FACE_R_DIM, 4 /* num_faces */, 4 /* num_faces */);
+    _llk_unpack_A_init_<BroadcastType::NONE, false, EltwiseBinaryReuseDestType::NONE, unpack_to_dest>(
+        0, 0, FACE_R_DIM, 4, formats.unpack_A_src, formats.unpack_A_dst);
+
+    for (int i = 0; i < params->TILE_CNT; i++)
+    {
+        _llk_unpack_A_<BroadcastType::NONE, false, EltwiseBinaryReuseDestType::NONE, unpack_to_dest>(
+            L1_ADDRESS(params->buffer_A[i]), formats.unpack_A_src, formats.unpack_A_dst);
+    }
+
+    // The raw-score row maxima of the softcap path land in dest tiles TILE_CNT onwards
+    if constexpr (SOFTCAP_EN)
+    {
+        for (int i = 0; i < params->TILE_CNT; i++)
+        {
+            _llk_unpack_A_<BroadcastType::NONE, false, EltwiseBinaryReuseDestType::NONE, unpack_to_dest>(
+                L1_ADDRESS(params->buffer_B[i]), formats.unpack_A_src, formats.unpack_A_dst);
+        }
+    }
+}
+
+#endif
+
+#ifdef LLK_TRISC_MATH
+
+#include "ckernel_sfpu.h"
+#include "llk_math_common.h"
+#include "llk_math_eltwise_binary_sfpu_params.h"
+#include "llk_math_eltwise_unary_datacopy.h"
+#include "llk_math_eltwise_unary_sfpu_params.h"
+
+using namespace ckernel;
+using namespace ckernel::sfpu;
+
+void run_kernel(const volatile struct RuntimeParams *params)
+{
+#ifdef ARCH_BLACKHOLE
+    _llk_math_eltwise_unary_datacopy_init_<DataCopyType::A2D, is_fp32_dest_acc_en, BroadcastType::NONE, false, false>(4, formats.math);
+#else
+    _llk_math_eltwise_unary_datacopy_init_<DataCopyType::A2D, is_fp32_dest_acc_en, BroadcastType::NONE, false>(4, formats.math);
+#endif
+    _llk_math_pack_sync_init_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+    _llk_math_hw_configure_<is_fp32_dest_acc_en>(formats.math, formats.math);
+    _llk_math_wait_for_dest_available_<DstSync::SyncHalf>();
+
+    const int dest_tiles = SOFTCAP_EN ? 2 * params->TILE_CNT : params->TILE_CNT;
+    for (int i = 0; i < dest_tiles; i++)
+    {
+        _llk_math_eltwise_unary_datacopy_<DataCopyType::A2D, DstSync::SyncHalf, is_fp32_dest_acc_en, BroadcastType::NONE, unpack_to_dest>(
+            i, formats.math, formats.math);
+    }
+
+    if constexpr (SOFTCAP_EN)
+    {
+        // The tanh argument is scaled by 1/(sqrt(d_k) * softcap)
+        constexpr float scale = SOFTMAX_SCALE / SOFTMAX_SOFTCAP;
+
+        _llk_math_eltwise_binary_sfpu_init_<SfpuType::unused>();
+        _init_softmax_exponential_<APPROX_MODE, true>();
+        for (int i = 0; i < params->TILE_CNT; i++)
+        {
+            _llk_math_eltwise_binary_sfpu_params_<APPROX_MODE>(
+                _calculate_softmax_exponential_softcap_<APPROX_MODE, 8>,
+                i,
+                params->TILE_CNT + i,
+                i,
+                static_cast<int>(VectorMode::RC),
+                __builtin_bit_cast(std::uint32_t, scale),
+                __builtin_bit_cast(std::uint32_t, SOFTMAX_SOFTCAP));
+        }
+    }
+    else
+    {
+        _llk_math_eltwise_unary_sfpu_init_<SfpuType::unused>();
+        _init_softmax_exponential_<APPROX_MODE, false>();
+        for (int i = 0; i < params->TILE_CNT; i++)
+        {
+            _llk_math_eltwise_unary_sfpu_params_<APPROX_MODE>(
+                _calculate_softmax_exponential_<APPROX_MODE, 8>, i, static_cast<int>(VectorMode::RC), __builtin_bit_cast(std::uint32_t, SOFTMAX_SCALE));
+        }
+    }
+
+    _llk_math_dest_section_done_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+}
+
+#endif
+
+#ifdef LLK_TRISC_PACK
+
+#include "llk_pack.h"
+#include "llk_pack_common.h"
+
+void run_kernel(const volatile struct RuntimeParams *params)
+{
+#ifdef ARCH_BLACKHOLE
+    _llk_pack_hw_configure_<is_fp32_dest_acc_en, false, false>(formats.pack_src, formats.pack_dst, 16 * 16 * 4);
+#else
+    _llk_pack_hw_configure_<is_fp32_dest_acc_en, false>(formats.pack_src, formats.pack_dst, 16 * 16 * 4);
+#endif
+
+    _llk_pack_init_<false, false>(formats.pack_dst);
+
+#ifdef ARCH_BLACKHOLE
+    _llk_pack_dest_init_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+#else
+    _llk_pack_dest_init_<DstSync::SyncHalf, is_fp32_dest_acc_en, false>();
+#endif
+
+    _llk_packer_wait_for_math_done_();
+    for (int i = 0; i < params->TILE_CNT; i++)
+    {
+        _llk_pack_<DstSync::SyncHalf, is_fp32_dest_acc_en, false>(i, L1_ADDRESS(params->buffer_Res[i]));
+    }
+    _llk_pack_dest_section_done_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+}
+
+#endif
@@ -236,4 +236,33 @@ enum class BinaryOp : std::uint8_t
     ADD_TOP_ROW   = 10
 };
 
+enum class TernaryOp : std::uint8_t
+{
+    FMA     = 0, // a * b + c
+    LERP    = 1, // a + c * (b - a), c being the weight
+    ADDCMUL = 2, // a + value * b * c
+    ADDCDIV = 3, // a + value * b / c
+    CLAMP   = 4, // min(max(a, b), c)
+};
+
+enum class OptimizerType : std::uint8_t
+{
+    ADAM  = 0, // Adam with L2 weight decay folded into the gradient
+    ADAMW = 1, // Adam with decoupled weight decay
+    LION  = 2, // sign-of-momentum update with decoupled weight decay
+};
+
+enum class RopeMode : std::uint8_t
+{
+    Interleaved = 0, // rotate adjacent pairs (x[2i], x[2i+1])
+    HalfSplit   = 1, // rotate half-split pairs (x[i], x[i + d/2]), a.k.a. rotate_half
+};
+
+enum class LutSymmetry : std::uint8_t
+{
+    Clamp = 0, // table spans [lo, hi]; inputs below lo are clamped to lo
+    Even  = 1, // f(-x) = f(x); table spans [0, hi]
+    Odd   = 2, // f(-x) = -f(x); table spans [0, hi]
+};
+
 } // namespace ckernel
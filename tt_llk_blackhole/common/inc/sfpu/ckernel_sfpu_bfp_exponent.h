@@ -0,0 +1,182 @@
+// SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+
+#include "ckernel_sfpu_row_reduce.h"
+#include "llk_defs.h"
+#include "sfpi.h"
+
+namespace ckernel
+{
+namespace sfpu
+{
+
+/**
+ * Shared exponent selection for Bfp packing
+ *
+ * The packer gives each block of 16 datums (one face row) the largest exponent E in the block, and each datum a
+ * MAN_BITS-bit magnitude m, so that the datum is m * 2^(E - 127 - (MAN_BITS - 1)). With a heavy-tailed block the
+ * one large element then pushes the small ones into the bottom few codes, which hurts most at Bfp4_b.
+ * _calculate_bfp_shared_exponent_ tries E and E - 1 for every block, the latter clipping the elements of the top
+ * octave to the largest magnitude code, and keeps whichever has the smaller squared error. It writes the block
+ * quantized to the chosen grid back to dest, so the packer's own max-exponent rule picks that exponent and its
+ * conversion is exact.
+ *
+ * The tile has to be fp32 in dest (dest_acc), with the Bfp format as pack_src_format: the gasket then converts it to
+ * the block format in one step, with no Float16 or Bfp8_a intermediate to round through.
+ */
+template <DataFormat BFP_FORMAT>
+struct BfpFormatTraits;
+
+template <>
+struct BfpFormatTraits<DataFormat::Bfp8_b>
+{
+    static constexpr int MAN_BITS = 7;
+};
+
+template <>
+struct BfpFormatTraits<DataFormat::Bfp4_b>
+{
+    static constexpr int MAN_BITS = 3;
+};
+
+// Squared error of quantizing mag to multiples of step, rounding to nearest even and saturating at MAN_BITS bits;
+// the quantized magnitude is returned in mag
+template <int MAN_BITS>
+sfpi_inline sfpi::vFloat _bfp_quantize_(sfpi::vFloat &mag, const sfpi::vFloat step, const sfpi::vFloat inv_step)
+{
+    sfpi::vInt m = sfpi::float_to_int16(mag * inv_step, 0);
+    v_if (m > (1 << MAN_BITS) - 1)
+    {
+        m = (1 << MAN_BITS) - 1;
+    }
+    v_endif;
+    sfpi::vFloat q   = sfpi::int32_to_float(m, 0) * step;
+    sfpi::vFloat err = mag - q;
+    mag              = q;
+    return err * err;
+}
+
+// Quantization step of a block with biased max exponent e and its inverse, as fp32 bits
+template <int MAN_BITS>
+sfpi_inline void _bfp_step_(const sfpi::vInt e, sfpi::vFloat &step, sfpi::vFloat &inv_step)
+{
+    step     = sfpi::reinterpret<sfpi::vFloat>((e - (MAN_BITS - 1)) << 23);
+    inv_step = sfpi::reinterpret<sfpi::vFloat>(((253 + MAN_BITS) - e) << 23);
+}
+
+/**
+ * @brief Picks the shared exponent of every 16-datum block of the tile in dst_index_in and quantizes the block to it
+ *
+ * Three passes over the 16 4-row groups: the per-row max magnitude, the per-row error difference between exponents
+ * E - 1 and E, and the quantization. The row reductions go through dst_index_scratch with _sfpu_row_allreduce_x2_,
+ * the scratch tile is clobbered. Blocks whose step at E - 1 would be denormal, and blocks holding inf or NaN, are left
+ * to the packer.
+ *
+ * Run with VectorMode::None.
+ */
+template <bool APPROXIMATION_MODE, DataFormat BFP_FORMAT>
+inline void _calculate_bfp_shared_exponent_(const std::uint32_t dst_index_in, const std::uint32_t dst_index_scratch)
+{
+    constexpr int MAN_BITS = BfpFormatTraits<BFP_FORMAT>::MAN_BITS;
+    // size of each tile in Dest is 64/SFP_DESTREG_STRIDE = 32 rows when using sfpi to load/store
+    constexpr std::uint32_t dst_tile_size_sfpi = 32;
+    constexpr std::uint32_t dst_tile_size_raw  = 64;
+    // Biased max exponents for which both candidate steps and their inverses are normal
+    constexpr int MIN_EXPONENT = MAN_BITS + 1;
+    constexpr int MAX_EXPONENT = 254;
+
+    const std::uint32_t in_base          = dst_index_in * dst_tile_size_sfpi;
+    const std::uint32_t scratch_base     = dst_index_scratch * dst_tile_size_sfpi;
+    const std::uint32_t scratch_base_raw = dst_index_scratch * dst_tile_size_raw;
+
+    // Group e holds rows 2 * (e % 8) to 2 * (e % 8) + 3 of face e / 8, even columns at e and odd columns at e + 1. The
+    // scratch tile keeps the block max in the even and the error difference in the odd slot of each group.
+#pragma GCC unroll 0
+    for (std::uint32_t e = 0; e < dst_tile_size_sfpi; e += 2)
+    {
+        sfpi::vFloat even = sfpi::setsgn(sfpi::dst_reg[in_base + e], 0);
+        sfpi::vFloat odd  = sfpi::setsgn(sfpi::dst_reg[in_base + e + 1], 0);
+        v_if (odd > even)
+        {
+            even = odd;
+        }
+        v_endif;
+        sfpi::dst_reg[scratch_base + e] = even;
+    }
+
+    // Raw addresses of group pairs, one face at a time
+    for (std::uint32_t addr = 0; addr < dst_tile_size_raw; addr += 8)
+    {
+        _sfpu_row_allreduce_x2_<true>(scratch_base_raw + addr, scratch_base_raw + addr);
+    }
+
+#pragma GCC unroll 0
+    for (std::uint32_t e = 0; e < dst_tile_size_sfpi; e += 2)
+    {
+        sfpi::vInt max_exp = sfpi::reinterpret<sfpi::vInt>(sfpi::vFloat(sfpi::dst_reg[scratch_base + e])) >> 23;
+
+        // A positive difference keeps E
+        sfpi::vFloat diff = 1.0f;
+        v_if (max_exp >= MIN_EXPONENT && max_exp <= MAX_EXPONENT)
+        {
+            sfpi::vFloat step, inv_step, clip_step, clip_inv_step;
+            _bfp_step_<MAN_BITS>(max_exp, step, inv_step);
+            _bfp_step_<MAN_BITS>(max_exp - 1, clip_step, clip_inv_step);
+
+            sfpi::vFloat even      = sfpi::setsgn(sfpi::dst_reg[in_base + e], 0);
+            sfpi::vFloat odd       = sfpi::setsgn(sfpi::dst_reg[in_base + e + 1], 0);
+            sfpi::vFloat even_clip = even;
+            sfpi::vFloat odd_clip  = odd;
+
+            sfpi::vFloat clip_err = _bfp_quantize_<MAN_BITS>(even_clip, clip_step, clip_inv_step);
+            clip_err += _bfp_quantize_<MAN_BITS>(odd_clip, clip_step, clip_inv_step);
+            sfpi::vFloat err = _bfp_quantize_<MAN_BITS>(even, step, inv_step);
+            err += _bfp_quantize_<MAN_BITS>(odd, step, inv_step);
+            diff = clip_err - err;
+        }
+        v_endif;
+        sfpi::dst_reg[scratch_base + e + 1] = diff;
+    }
+
+    for (std::uint32_t addr = 0; addr < dst_tile_size_raw; addr += 8)
+    {
+        _sfpu_row_allreduce_x2_<false>(scratch_base_raw + addr + 2, scratch_base_raw + addr + 2);
+    }
+
+#pragma GCC unroll 0
+    for (std::uint32_t e = 0; e < dst_tile_size_sfpi; e += 2)
+    {
+        sfpi::vInt max_exp = sfpi::reinterpret<sfpi::vInt>(sfpi::vFloat(sfpi::dst_reg[scratch_base + e])) >> 23;
+
+        v_if (max_exp >= MIN_EXPONENT && max_exp <= MAX_EXPONENT)
+        {
+            sfpi::vFloat diff = sfpi::dst_reg[scratch_base + e + 1];
+            v_if (diff < 0.0f)
+            {
+                max_exp = max_exp - 1;
+            }
+            v_endif;
+
+            sfpi::vFloat step, inv_step;
+            _bfp_step_<MAN_BITS>(max_exp, step, inv_step);
+
+            sfpi::vFloat even     = sfpi::dst_reg[in_base + e];
+            sfpi::vFloat odd      = sfpi::dst_reg[in_base + e + 1];
+            sfpi::vFloat even_mag = sfpi::setsgn(even, 0);
+            sfpi::vFloat odd_mag  = sfpi::setsgn(odd, 0);
+            _bfp_quantize_<MAN_BITS>(even_mag, step, inv_step);
+            _bfp_quantize_<MAN_BITS>(odd_mag, step, inv_step);
+            sfpi::dst_reg[in_base + e]     = sfpi::setsgn(even_mag, even);
+            sfpi::dst_reg[in_base + e + 1] = sfpi::setsgn(odd_mag, odd);
+        }
+        v_endif;
+    }
+}
+
+} // namespace sfpu
+} // namespace ckernel
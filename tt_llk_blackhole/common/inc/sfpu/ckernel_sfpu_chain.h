@@ -0,0 +1,161 @@
+// SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+
+#include "ckernel_sfpu_accuracy.h"
+#include "ckernel_sfpu_log.h"
+#include "ckernel_sfpu_recip.h"
+#include "llk_defs.h"
+#include "sfpi.h"
+
+namespace ckernel::sfpu
+{
+
+/**
+ * @brief Applies a compile-time chain of per-element SFPU bodies with a single dest load and store per row group.
+ *
+ * Each link is a class template over APPROXIMATION_MODE providing
+ *   static sfpi_inline sfpi::vFloat apply(sfpi::vFloat val, sfpi::vFloat in);
+ *   static inline void init();
+ * where val is the output of the previous link (the dest value for the first one) and in is always the dest value,
+ * so x * f(x) style activations (Mish, Swish, GELU) need no extra pass. Intermediates stay in LREGs, so a chain of
+ * N links costs one dest round trip instead of N.
+ *
+ * The links below run the exp, tanh and reciprocal of ckernel_sfpu_accuracy.h at the Bf16 tier in APPROXIMATION_MODE
+ * and the Fp32 tier otherwise. They share the programmable constants of _init_sfpu_reciprocal_<false> only, so any of
+ * them can be chained together.
+ */
+template <bool APPROXIMATION_MODE, int ITERATIONS, template <bool> class... Links>
+inline void _calculate_sfpu_chain_()
+{
+#pragma GCC unroll 0
+    for (int d = 0; d < ITERATIONS; d++)
+    {
+        const sfpi::vFloat in = sfpi::dst_reg[0];
+        sfpi::vFloat val      = in;
+        ((val = Links<APPROXIMATION_MODE>::apply(val, in)), ...);
+        sfpi::dst_reg[0] = val;
+        sfpi::dst_reg++;
+    }
+}
+
+template <bool APPROXIMATION_MODE, template <bool> class... Links>
+inline void _init_sfpu_chain_()
+{
+    (Links<APPROXIMATION_MODE>::init(), ...);
+}
+
+// Accuracy tier of the chain links
+constexpr SfpuAccuracy sfpu_chain_accuracy(const bool approximation_mode)
+{
+    return approximation_mode ? SfpuAccuracy::Bf16 : SfpuAccuracy::Fp32;
+}
+
+// exp(val)
+template <bool APPROXIMATION_MODE>
+struct SfpuChainExp
+{
+    static sfpi_inline sfpi::vFloat apply(sfpi::vFloat val, sfpi::vFloat)
+    {
+        return _sfpu_exp_tiered_<sfpu_chain_accuracy(APPROXIMATION_MODE)>(val);
+    }
+
+    static inline void init()
+    {
+    }
+};
+
+// ln(val), the same in both modes
+template <bool APPROXIMATION_MODE>
+struct SfpuChainLog
+{
+    static sfpi_inline sfpi::vFloat apply(sfpi::vFloat val, sfpi::vFloat)
+    {
+        return _calculate_log_body_no_init_(val);
+    }
+
+    static inline void init()
+    {
+    }
+};
+
+// ln(1 + val), the same in both modes
+template <bool APPROXIMATION_MODE>
+struct SfpuChainLog1p
+{
+    static sfpi_inline sfpi::vFloat apply(sfpi::vFloat val, sfpi::vFloat)
+    {
+        return _calculate_log_body_no_init_(val + sfpi::vConst1);
+    }
+
+    static inline void init()
+    {
+    }
+};
+
+// 1 / (1 + exp(-val))
+template <bool APPROXIMATION_MODE>
+struct SfpuChainSigmoid
+{
+    static sfpi_inline sfpi::vFloat apply(sfpi::vFloat val, sfpi::vFloat)
+    {
+        constexpr SfpuAccuracy ACCURACY = sfpu_chain_accuracy(APPROXIMATION_MODE);
+
+        sfpi::vFloat exp_neg = _sfpu_exp_tiered_<ACCURACY>(-val);
+        return _sfpu_reciprocal_<sfpu_accuracy_reciprocal_iterations(ACCURACY)>(exp_neg + sfpi::vConst1);
+    }
+
+    static inline void init()
+    {
+        _init_sfpu_reciprocal_<false>();
+    }
+};
+
+// tanh(val)
+template <bool APPROXIMATION_MODE>
+struct SfpuChainTanh
+{
+    static sfpi_inline sfpi::vFloat apply(sfpi::vFloat val, sfpi::vFloat)
+    {
+        return _sfpu_tanh_tiered_<sfpu_chain_accuracy(APPROXIMATION_MODE)>(val);
+    }
+
+    static inline void init()
+    {
+        _init_sfpu_reciprocal_<false>();
+    }
+};
+
+// val * in, closes x * f(x) activations
+template <bool APPROXIMATION_MODE>
+struct SfpuChainMulInput
+{
+    static sfpi_inline sfpi::vFloat apply(sfpi::vFloat val, sfpi::vFloat in)
+    {
+        return val * in;
+    }
+
+    static inline void init()
+    {
+    }
+};
+
+// Mish: x * tanh(ln(1 + exp(x)))
+template <bool APPROXIMATION_MODE, int ITERATIONS>
+inline void _calculate_mish_chain_()
+{
+    _calculate_sfpu_chain_<APPROXIMATION_MODE, ITERATIONS, SfpuChainExp, SfpuChainLog1p, SfpuChainTanh, SfpuChainMulInput>();
+}
+
+// Swish / SiLU: x * sigmoid(x)
+template <bool APPROXIMATION_MODE, int ITERATIONS>
+inline void _calculate_swish_chain_()
+{
+    _calculate_sfpu_chain_<APPROXIMATION_MODE, ITERATIONS, SfpuChainSigmoid, SfpuChainMulInput>();
+}
+
+} // namespace ckernel::sfpu
@@ -7,6 +7,8 @@
 #include <cstdint>
 
 #include "ckernel_ops.h"
+#include "ckernel_sfpu_converter.h"
+#include "ckernel_sfpu_random.h"
 #include "sfpi.h"
 #include "sfpi_fp16.h"
 
@@ -64,5 +66,57 @@ inline void _init_dropout_(const std::uint32_t seed)
     init_prng_seed(seed);
 }
 
+/**
+ * @brief Dropout with a mask that depends only on (seed, stream, tile_index), not on execution order.
+ *
+ * Same probability and scale encoding as _calculate_dropout_. Running it again with the same key and tile_index
+ * regenerates the same mask, e.g. for the backward pass. Covers the whole tile in one call; run with VectorMode::None.
+ * Requires _init_dropout_threefry_.
+ */
+template <bool APPROXIMATION_MODE, int ROUNDS = 20>
+inline void _calculate_dropout_threefry_(const std::uint32_t tile_index, const std::uint32_t probability, const std::uint32_t scale)
+{
+    const float scale_f = Converter::as_float(scale);
+
+    sfpi::vUInt counter = _threefry_lane_counter_();
+
+#pragma GCC unroll 0
+    for (int pair = 0; pair < 16; pair++)
+    {
+        sfpi::vUInt x0 = counter;
+        sfpi::vUInt x1 = tile_index;
+        _sfpu_threefry2x32_<ROUNDS>(x0, x1);
+
+        // Top 31 bits, for a signed comparison with probability
+        sfpi::vInt r0 = sfpi::reinterpret<sfpi::vInt>(x0 >> 1);
+        sfpi::vInt r1 = sfpi::reinterpret<sfpi::vInt>(x1 >> 1);
+
+        sfpi::vFloat v0 = sfpi::dst_reg[0] * scale_f;
+        v_if (r0 < static_cast<int>(probability))
+        {
+            v0 = 0.0f;
+        }
+        v_endif;
+        sfpi::dst_reg[0] = v0;
+
+        sfpi::vFloat v1 = sfpi::dst_reg[1] * scale_f;
+        v_if (r1 < static_cast<int>(probability))
+        {
+            v1 = 0.0f;
+        }
+        v_endif;
+        sfpi::dst_reg[1] = v1;
+
+        counter = counter + 32;
+        sfpi::dst_reg++;
+        sfpi::dst_reg++;
+    }
+}
+
+inline void _init_dropout_threefry_(const std::uint32_t seed, const std::uint32_t stream = 0)
+{
+    _init_threefry_(seed, stream);
+}
+
 } // namespace sfpu
 } // namespace ckernel
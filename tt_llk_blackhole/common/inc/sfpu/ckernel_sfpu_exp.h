@@ -8,6 +8,7 @@
 
 #include "ckernel_addrmod.h"
 #include "ckernel_ops.h"
+#include "ckernel_sfpu_loadmacro.h"
 #include "ckernel_sfpu_recip.h"
 #include "lltt.h"
 #include "sfpi.h"
@@ -175,53 +176,8 @@ void _calculate_exponential_(const std::uint16_t exp_base_scale_factor /* 1.0f i
         //  ROUND  : unused
         //  SIMPLE : SWAP the larger value of y and -88.5 into the LREG
         //  STORE  : store the sanitized value back to dest
-        TTI_SFPLOADMACRO(
-            4,
-            0,
-            ADDR_MOD_7,
-            0);     // MACRO Sequence Register 1: LD, SWAP, STORE - uses LREG[0] for loaded value - Dest offset  0 is targeting the even columns for rows   3: 0
-        TTI_SFPNOP; // NOP is necessary because the SWAP operation takes 2 cycles and unfortunately is not pipelined
-        TTI_SFPLOADMACRO(
-            5,
-            0,
-            ADDR_MOD_7,
-            2); // MACRO Sequence Register 1: LD, SWAP, STORE - uses LREG[1] for loaded value - Dest offset  2 is targeting the odd  columns for rows   3: 0
-        TTI_SFPNOP;
-        TTI_SFPLOADMACRO(
-            6,
-            0,
-            ADDR_MOD_7,
-            4); // MACRO Sequence Register 1: LD, SWAP, STORE - uses LREG[2] for loaded value - Dest offset  4 is targeting the even columns for rows   7: 4
-        TTI_SFPNOP;
-        TTI_SFPLOADMACRO(
-            7,
-            0,
-            ADDR_MOD_7,
-            6); // MACRO Sequence Register 1: LD, SWAP, STORE - uses LREG[3] for loaded value - Dest offset  6 is targeting the odd  columns for rows   7: 4
-        TTI_SFPNOP;
-        TTI_SFPLOADMACRO(
-            4,
-            0,
-            ADDR_MOD_7,
-            8); // MACRO Sequence Register 1: LD, SWAP, STORE - uses LREG[0] for loaded value - Dest offset  8 is targeting the even columns for rows  11: 8
-        TTI_SFPNOP;
-        TTI_SFPLOADMACRO(
-            5,
-            0,
-            ADDR_MOD_7,
-            10); // MACRO Sequence Register 1: LD, SWAP, STORE - uses LREG[1] for loaded value - Dest offset 10 is targeting the even columns for rows  11: 8
-        TTI_SFPNOP;
-        TTI_SFPLOADMACRO(
-            6,
-            0,
-            ADDR_MOD_7,
-            12); // MACRO Sequence Register 1: LD, SWAP, STORE - uses LREG[2] for loaded value - Dest offset 12 is targeting the odd  columns for rows  15:12
-        TTI_SFPNOP;
-        TTI_SFPLOADMACRO(
-            7,
-            0,
-            ADDR_MOD_7,
-            14); // MACRO Sequence Register 1: LD, SWAP, STORE - uses LREG[3] for loaded value - Dest offset 14 is targeting the even columns for rows  15:12
+        //  LREG[0-3] rotate as load registers over dest offsets 0-14; the SWAP takes 2 cycles and is not pipelined, so a NOP separates the issues
+        _sfpu_loadmacro_run_<1, 8, 1>();
         // NOP not needed in this spot because the next LoadMacro is a computational macro which doesn't immediately use the SIMPLE unit
 
         // Macro Sequence Register 0 configured to read back in the sanitized values and calculate the approximate exponential value
@@ -230,22 +186,8 @@ void _calculate_exponential_(const std::uint16_t exp_base_scale_factor /* 1.0f i
         //  ROUND  : convert the MAD result from FP32 to a 16-bit unsigned integer using stochastic rounding
         //  SIMPLE : shift the 16-bit integer to the left by 15 bits to place the MSB of the computed value into the MSB of the exponent bits of the fp32 format
         //  STORE  : store the shifted value back to dest
-        TTI_SFPLOADMACRO(0, 0, ADDR_MOD_7, 0); // MACRO Sequence Register 0: LD, MAD, ROUND, SHIFT and STORE - uses LREG[0] for loading and intermediate results
-                                               // - Dest offset  0 is targeting the even columns for rows   3: 0
-        TTI_SFPLOADMACRO(1, 0, ADDR_MOD_7, 2); // MACRO Sequence Register 0: LD, MAD, ROUND, SHIFT and STORE - uses LREG[1] for loading and intermediate results
-                                               // - Dest offset  2 is targeting the odd  columns for rows   3: 0
-        TTI_SFPLOADMACRO(2, 0, ADDR_MOD_7, 4); // MACRO Sequence Register 0: LD, MAD, ROUND, SHIFT and STORE - uses LREG[2] for loading and intermediate results
-                                               // - Dest offset  4 is targeting the even columns for rows   7: 4
-        TTI_SFPLOADMACRO(3, 0, ADDR_MOD_7, 6); // MACRO Sequence Register 0: LD, MAD, ROUND, SHIFT and STORE - uses LREG[3] for loading and intermediate results
-                                               // - Dest offset  6 is targeting the odd  columns for rows   7: 4
-        TTI_SFPLOADMACRO(0, 0, ADDR_MOD_7, 8); // MACRO Sequence Register 0: LD, MAD, ROUND, SHIFT and STORE - uses LREG[0] for loading and intermediate results
-                                               // - Dest offset  8 is targeting the even columns for rows  11: 8
-        TTI_SFPLOADMACRO(1, 0, ADDR_MOD_7, 10); // MACRO Sequence Register 0: LD, MAD, ROUND, SHIFT and STORE - uses LREG[1] for loading and intermediate
-                                                // results - Dest offset 10 is targeting the even columns for rows  11: 8
-        TTI_SFPLOADMACRO(2, 0, ADDR_MOD_7, 12); // MACRO Sequence Register 0: LD, MAD, ROUND, SHIFT and STORE - uses LREG[2] for loading and intermediate
-                                                // results - Dest offset 12 is targeting the odd  columns for rows  15:12
-        TTI_SFPLOADMACRO(3, 0, ADDR_MOD_7, 14); // MACRO Sequence Register 0: LD, MAD, ROUND, SHIFT and STORE - uses LREG[3] for loading and intermediate
-                                                // results - Dest offset 14 is targeting the even columns for rows  15:12
+        //  LREG[0-3] rotate as load registers over dest offsets 0-14
+        _sfpu_loadmacro_run_<0, 8>();
         // NOP needed to allow time for the final Computation Loadmacro to complete before returning to the Sanitation Loadmacro at the top for the next
         // iteration
         //  - to be completely safe, use 3 NOP; in practice 1 seems to be enough, probably because the overhead of the DEST INCRW stuff introduces 2 cycles of
@@ -394,11 +336,8 @@ inline void _init_exponential_()
         //              instr_mod1 = 1 swap the values with the larger of the two ending up in lreg_dest -> but we will use the Loadmacro lreg_dest register as
         //              output
         // TTI_SFP_SWAP(0,               0,                                                                                14,                            1);
-        TTI_SFPLOADI(0, 0xA, 0x00E1);
-        TTI_SFPLOADI(0, 0x8, 0x9200);
-        TTI_SFPCONFIG(0, 0, 0); // SFPCONFIG Dest 0 = Programmable Macro instruction 0: TTI_SFPSWAP(0, 0, 14, 1); // compare against LREG[14] (-88.5), and put
-                                // the larger value into LREG[loadmacro_lreg_dest]
-        TTI_SFPNOP;
+        _sfpu_loadmacro_program_instruction_<0, TT_OP_SFPSWAP(0, 0, 14, 1)>(); // Programmable Macro instruction 0: compare against LREG[14] (-88.5), and put
+                                                                              // the larger value into LREG[loadmacro_lreg_dest]
 
         // Backdoor load of Macro Instruction 1
         // Dummy version of MAD instruction with lreg_dest = 4'b11_01 = 13 to install into Programmable Macro instruction register 1, which is Macro Instruction
@@ -435,13 +374,13 @@ inline void _init_exponential_()
         //                                                                                                                                                                                                 Loaded  Result          Macro
         //                                                                                                                                                                                                 Value   Value   Delay   Instruction
         //                                                                                                                                                                                                 SRCB    Stage   Slot    Select
-        TTI_SFPLOADI(0, 0xA, 0x0004); // slot1 : SIMPLE UNIT, want SWAP  instruction which is in macro instruction mux[4], delayed by 0 ; not using staging flop
-                                      // as dest; not using load reg as srcb : 8'b0_______0_______000_____100          = 0x04 slot2 : MAD    UNIT, unused :
-                                      // 8'b0_______0_______000_____000          = 0x00
-        TTI_SFPLOADI(0, 0x8, 0x1300); // slot3 : ROUND  UNIT, unused : 8'b0_______0_______000_____000          = 0x00 slot4 : STORE  UNIT, want STORE
-                                      // instruction which is in macro instruction mux[3], delayed by 2 ; not using staging flop as src ; :
-                                      // 8'b0_______0_______010_____011          = 0x13
-        TTI_SFPCONFIG(0, 5, 0);       // SFPCONFIG Dest 5 = Macro Sequence Register 1
+        _sfpu_loadmacro_program_sequence_<
+            1,
+            loadmacro_sequence(
+                loadmacro_slot(loadmacro_instr(0), 0),  // SIMPLE: SWAP, delay 0
+                LOADMACRO_NONE,                         // MAD   : unused
+                LOADMACRO_NONE,                         // ROUND : unused
+                loadmacro_slot(LOADMACRO_STORE, 2))>(); // STORE : delay 2
 
         // Sequence 0 setup: we want to Load, MAD, <delay>, ROUND, SHIFT, Store
         //       Delay slot:                  0    1        2      3      4
@@ -449,19 +388,13 @@ inline void _init_exponential_()
         //                                                                                                                                                                                                 Loaded  Result          Macro
         //                                                                                                                                                                                                 Value   Value   Delay   Instruction
         //                                                                                                                                                                                                 SRCB    Stage   Slot    Select
-        TTI_SFPLOADI(
+        _sfpu_loadmacro_program_sequence_<
             0,
-            0xA,
-            0x85DF); // slot1 : SIMPLE UNIT, want SHIFT instruction which is in macro instruction mux[7], delayed by 3 ;     using staging flop as dest; using
-                     // load reg as srcb : 8'b1_______1_______011_____111          = 0xDF slot2 : MAD    UNIT, want MAD   instruction which is in macro
-                     // instruction mux[5], delayed by 0 ; not using staging flop as dest;     using load reg as srcb : 8'b1_______0_______000_____101 = 0x85
-        TTI_SFPLOADI(
-            0,
-            0x8,
-            0x6316); // slot3 : ROUND  UNIT, want ROUND instruction which is in macro instruction mux[6], delayed by 2 ; not using staging flop as dest; using
-                     // : 8'b0_______0_______010_____110          = 0x16 slot4 : STORE  UNIT, want STORE instruction which is in macro instruction mux[3],
-                     // delayed by 4 ;     using staging flop as src ;     using                  : 8'b0_______1_______100_____011          = 0x63
-        TTI_SFPCONFIG(0, 4, 0); // Load it into macro sequence register 0 (destination = 4)
+            loadmacro_sequence(
+                loadmacro_slot(loadmacro_instr(3), 3, true, true),   // SIMPLE: SHIFT, delay 3, loaded value as srcb, result to staging
+                loadmacro_slot(loadmacro_instr(1), 0, true),         // MAD   : MAD, delay 0, loaded value as srcb
+                loadmacro_slot(loadmacro_instr(2), 2),               // ROUND : ROUND, delay 2
+                loadmacro_slot(LOADMACRO_STORE, 4, false, true))>(); // STORE : delay 4, from staging
 
         // Reset LoadMacroConfig[Lane].Misc for all lanes, in case it has been previously set by another use of macros.
         TTI_SFPCONFIG(0, 8, 1);
@@ -574,9 +507,13 @@ inline void _init_exponential_()
         //   - STOCHRND delay 3: 0x1E
         //   - SETSGN delay 5: 0xEF
         //   - STORE delay 6: 0x73
-        TTI_SFPLOADI(0, 0xA, 0x85EF); // Slots 1-2: Simple=0xEF (delay 5), MAD=0x85
-        TTI_SFPLOADI(0, 0x8, 0x731E); // Slots 3-4: Round=0x1E (delay 3), Store=0x73 (delay 6)
-        TTI_SFPCONFIG(0, 4, 0);       // Load into Macro Sequence Register 0 (dest=4)
+        _sfpu_loadmacro_program_sequence_<
+            0,
+            loadmacro_sequence(
+                loadmacro_slot(loadmacro_instr(3), 5, true, true),   // Simple=0xEF (delay 5)
+                loadmacro_slot(loadmacro_instr(1), 0, true),         // MAD=0x85
+                loadmacro_slot(loadmacro_instr(2), 3),               // Round=0x1E (delay 3)
+                loadmacro_slot(LOADMACRO_STORE, 6, false, true))>(); // Store=0x73 (delay 6)
 
         // Reset LoadMacroConfig[Lane].Misc for all lanes
         // Sets StoreMod0=0 (SRCB), UsesLoadMod0ForStore=0, UnitDelayKind=0xF
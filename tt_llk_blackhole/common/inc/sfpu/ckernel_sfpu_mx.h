@@ -0,0 +1,223 @@
+// SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+
+#include "ckernel.h"
+#include "ckernel_addrmod.h"
+#include "llk_defs.h"
+#include "sfpi.h"
+
+namespace ckernel
+{
+namespace sfpu
+{
+
+/**
+ * MX dequantization
+ *
+ * The packer and unpacker have no MX formats, so MX tiles are kept in L1 as a UInt32 tile of bit-packed elements plus
+ * the E8M0 scales of their 32 blocks each. Block b of a tile is elements [32 * b, 32 * b + 32) in L1 order, i.e. rows
+ * 2 * (b % 8) and 2 * (b % 8) + 1 of face b / 8.
+ *
+ * The packed tile is unpacked to dest as it is, and every SFPU lane sees its words as one bit stream: the element the
+ * lane holds in sfpi row r of MX tile t sits at bits [(32 * t + r) * WIDTH, (32 * t + r + 1) * WIDTH) of the stream,
+ * word w of the stream being sfpi row w of the packed tile. An MX tile thus takes WIDTH sfpi rows of the packed tile,
+ * 6-bit elements straddling words. _calculate_mx_dequant_ extracts the elements of one MX tile with shifts, turns them
+ * into fp32 in another dest tile, and that tile is packed to Float16_b or Float32 for matmul to consume.
+ *
+ * Quasar lists MxFp4, MxFp6R/P and MxInt8 among its hardware data formats, with its own L1 layout (MXFP6 elements in
+ * 8-bit containers), so it would unpack them directly rather than through this path. Only MxFp8R/P are wired up and
+ * tested there so far: the test infrastructure has no stimuli, golden or readback for the other MX formats.
+ */
+template <MxFormat FORMAT>
+struct MxFormatTraits;
+
+template <>
+struct MxFormatTraits<MxFormat::MxFp4>
+{
+    static constexpr int WIDTH    = 4;
+    static constexpr int MAN_BITS = 1;
+    static constexpr int BIAS     = 1;
+};
+
+template <>
+struct MxFormatTraits<MxFormat::MxFp6E2M3>
+{
+    static constexpr int WIDTH    = 6;
+    static constexpr int MAN_BITS = 3;
+    static constexpr int BIAS     = 1;
+};
+
+template <>
+struct MxFormatTraits<MxFormat::MxFp6E3M2>
+{
+    static constexpr int WIDTH    = 6;
+    static constexpr int MAN_BITS = 2;
+    static constexpr int BIAS     = 3;
+};
+
+// E8M0 scale to the upper half of the fp32 it encodes. 2^-127 is an fp32 denormal and reads as zero in dest.
+inline std::uint32_t _mx_scale_to_fp16b_(const std::uint32_t scale)
+{
+    return (scale == 0xFF) ? 0x7FC0 : (scale << 7);
+}
+
+// Value of an MX element held in the low byte of element, before scaling
+template <MxFormat FORMAT>
+sfpi_inline sfpi::vFloat _sfpu_mx_element_to_fp32_(const sfpi::vInt element)
+{
+    sfpi::vFloat out;
+    if constexpr (FORMAT == MxFormat::MxInt8)
+    {
+        sfpi::vInt mag = element;
+        v_if (element >= 0x80)
+        {
+            mag = 0x100 - element;
+        }
+        v_endif;
+        out = sfpi::int32_to_float(mag, 0) * (1.0f / 64.0f);
+    }
+    else
+    {
+        using traits              = MxFormatTraits<FORMAT>;
+        constexpr float SUB_SCALE = 1.0f / static_cast<float>(1 << (traits::BIAS - 1 + traits::MAN_BITS)); // 2^(1 - bias - man)
+
+        sfpi::vInt mag = sfpi::reinterpret<sfpi::vInt>(sfpi::reinterpret<sfpi::vUInt>(element & 0x7F) >> (8 - traits::WIDTH));
+        v_if (mag < (1 << traits::MAN_BITS))
+        {
+            out = sfpi::int32_to_float(mag, 0) * SUB_SCALE;
+        }
+        v_else
+        {
+            out = sfpi::reinterpret<sfpi::vFloat>((mag << (23 - traits::MAN_BITS)) + ((127 - traits::BIAS) << 23));
+        }
+        v_endif;
+    }
+
+    v_if ((element & 0x80) != 0)
+    {
+        out = sfpi::setsgn(out, 1);
+    }
+    v_endif;
+    return out;
+}
+
+// Width in bits of the elements of FORMAT
+template <MxFormat FORMAT>
+constexpr int _mx_element_width_()
+{
+    return (FORMAT == MxFormat::MxFp4) ? 4 : (FORMAT == MxFormat::MxInt8) ? 8 : 6;
+}
+
+// Shifts LREG by SHIFT bits, left if positive and logically right if negative
+template <int LREG, int SHIFT>
+inline void _mx_shift_()
+{
+    if constexpr (SHIFT != 0)
+    {
+        TTI_SFPSHFT(SHIFT & 0xfff, LREG, LREG, 1);
+    }
+}
+
+// Element K of the group of packed words held in LREG0 onwards, MSB-aligned in the low byte of LREG4
+template <int WIDTH, int K>
+inline void _mx_extract_element_()
+{
+    constexpr int BIT      = K * WIDTH;
+    constexpr int WORD     = p_sfpu::LREG0 + BIT / 32;
+    constexpr int SHIFT    = BIT % 32;
+    constexpr int LOW_BITS = 32 - SHIFT;
+
+    TTI_SFPMOV(0, WORD, p_sfpu::LREG4, 0);
+    if constexpr (LOW_BITS >= WIDTH)
+    {
+        // Up to the top of the word to drop the elements above, then down to the bottom
+        _mx_shift_<p_sfpu::LREG4, LOW_BITS - WIDTH>();
+        _mx_shift_<p_sfpu::LREG4, WIDTH - 32>();
+    }
+    else
+    {
+        // The top bits of the element continue at the bottom of the next word
+        _mx_shift_<p_sfpu::LREG4, -SHIFT>();
+        TTI_SFPMOV(0, WORD + 1, p_sfpu::LREG5, 0);
+        _mx_shift_<p_sfpu::LREG5, 32 - (WIDTH - LOW_BITS)>();
+        _mx_shift_<p_sfpu::LREG5, WIDTH - 32>();
+        TTI_SFPOR(0, p_sfpu::LREG5, p_sfpu::LREG4, 0);
+    }
+    _mx_shift_<p_sfpu::LREG4, 8 - WIDTH>();
+}
+
+// Writes elements K onwards of the group to consecutive sfpi rows from raw dest address addr
+template <int WIDTH, int GROUP_ELEMENTS, int K = 0>
+inline void _mx_extract_group_(const std::uint32_t addr)
+{
+    if constexpr (K < GROUP_ELEMENTS)
+    {
+        _mx_extract_element_<WIDTH, K>();
+        TT_SFPSTORE(p_sfpu::LREG4, InstrModLoadStore::INT32, ADDR_MOD_7, addr);
+        _mx_extract_group_<WIDTH, GROUP_ELEMENTS, K + 1>(addr + 2);
+    }
+}
+
+/**
+ * @brief Dequantizes MX tile packed_tile of the bit-packed stream starting at dest tile dst_index_packed
+ *
+ * The elements are first extracted to dst_index_out, one per lane and MSB-aligned in the low byte, with integer loads
+ * and stores so that no word is read as a float. Each group of GROUP_WORDS words holds a whole number of elements
+ * (8 of 4 bits, 16 of 6 bits in 3 words, 4 of 8 bits), so the shifts are all known at compile time. The elements are
+ * then turned into fp32 in place, lanes 0-15 and 16-31 of a pair of sfpi rows being two blocks with their own scales.
+ * The stream may run on into the dest tiles after dst_index_packed.
+ *
+ * Run with VectorMode::None and dst_index 0.
+ *
+ * @param scales E8M0 scales of the 32 blocks of the MX tile in L1
+ */
+template <bool APPROXIMATION_MODE, MxFormat FORMAT>
+inline void _calculate_mx_dequant_(
+    const std::uint32_t dst_index_packed, const std::uint32_t packed_tile, const std::uint32_t dst_index_out, const volatile std::uint8_t tt_l1_ptr *scales)
+{
+    constexpr int WIDTH = _mx_element_width_<FORMAT>();
+    // Fewest words that hold a whole number of elements: one, or three for 6-bit elements
+    constexpr int GROUP_WORDS    = (32 % WIDTH == 0) ? 1 : 3;
+    constexpr int GROUP_ELEMENTS = 32 * GROUP_WORDS / WIDTH;
+    // size of each tile in Dest is 64/SFP_DESTREG_STRIDE = 32 rows when using sfpi to load/store
+    constexpr std::uint32_t dst_tile_size_sfpi = 32;
+
+    const std::uint32_t packed_base = dst_index_packed * dst_tile_size_sfpi + packed_tile * WIDTH;
+    const std::uint32_t out_base    = dst_index_out * dst_tile_size_sfpi;
+
+#pragma GCC unroll 0
+    for (std::uint32_t group = 0; group < dst_tile_size_sfpi / GROUP_ELEMENTS; group++)
+    {
+        const std::uint32_t words = packed_base + group * GROUP_WORDS;
+        for (int w = 0; w < GROUP_WORDS; w++)
+        {
+            TT_SFPLOAD(p_sfpu::LREG0 + w, InstrModLoadStore::INT32, ADDR_MOD_7, 2 * (words + w));
+        }
+        _mx_extract_group_<WIDTH, GROUP_ELEMENTS>(2 * (out_base + group * GROUP_ELEMENTS));
+    }
+
+#pragma GCC unroll 0
+    for (std::uint32_t row = 0; row < dst_tile_size_sfpi; row++)
+    {
+        const std::uint32_t block = row & ~1u;
+
+        sfpi::vFloat scale = sfpi::s2vFloat16b(_mx_scale_to_fp16b_(scales[block]));
+        // vConstTileId holds 2 * lane
+        v_if ((sfpi::vConstTileId & 0x20) != 0)
+        {
+            scale = sfpi::s2vFloat16b(_mx_scale_to_fp16b_(scales[block + 1]));
+        }
+        v_endif;
+
+        sfpi::vInt element            = sfpi::dst_reg[out_base + row];
+        sfpi::dst_reg[out_base + row] = _sfpu_mx_element_to_fp32_<FORMAT>(element) * scale;
+    }
+}
+
+} // namespace sfpu
+} // namespace ckernel
@@ -0,0 +1,329 @@
+// SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+
+#include "ckernel_addrmod.h"
+#include "ckernel_instr_params.h"
+#include "ckernel_sfpu_accuracy.h"
+#include "ckernel_sfpu_converter.h"
+#include "ckernel_sfpu_exp.h"
+#include "ckernel_sfpu_load_config.h"
+#include "ckernel_sfpu_log.h"
+#include "ckernel_sfpu_row_reduce.h"
+#include "llk_defs.h"
+#include "sfpi.h"
+
+namespace ckernel::sfpu
+{
+
+/**
+ * @brief Softmax numerator of attention scores with the score scaling folded into the exp pass.
+ *
+ * out = exp(scale * x)
+ * Run on scores that already had the row max subtracted; as scale > 0 this equals exp(scale * x - max(scale * x)).
+ * scale is 1/sqrt(d_k), as an FP32 bit pattern. Requires _init_softmax_exponential_<APPROXIMATION_MODE, false>.
+ */
+template <bool APPROXIMATION_MODE, int ITERATIONS>
+inline void _calculate_softmax_exponential_(const std::uint32_t scale)
+{
+    // The row max was subtracted, so the exp input is non-positive and the overflow check can be skipped
+    constexpr bool SKIP_POSITIVE_CHECK = true;
+
+    const sfpi::vFloat v_scale = Converter::as_float(scale);
+
+#pragma GCC unroll 0
+    for (int d = 0; d < ITERATIONS; d++)
+    {
+        sfpi::vFloat val = sfpi::dst_reg[0] * v_scale;
+        sfpi::dst_reg[0] = _calculate_exponential_piecewise_<APPROXIMATION_MODE, false, SKIP_POSITIVE_CHECK>(val, p_sfpu::kCONST_1_FP16B);
+        sfpi::dst_reg++;
+    }
+}
+
+/**
+ * @brief Softmax numerator of soft-capped attention scores: out = exp(softcap * tanh(scale * x) - max(capped row)).
+ *
+ * dst_index_max holds the row max of the raw scores broadcast along each row, as a max reduction over the scores
+ * leaves it. tanh is monotonic, so capping it gives the max of the capped scores, and the exp input stays within a
+ * rounding error of zero from above. Rows far below softcap keep their full dynamic range, which subtracting the
+ * softcap bound instead would flush to zero once the row max sits some 87 below it.
+ *
+ * tanh and exp are the tiered implementations of ckernel_sfpu_accuracy.h. Any tanh error is scaled up by softcap, and
+ * the LUT tanh, off by up to 0.15, would shift scores by several units at a softcap of 30-50; tanh therefore always
+ * runs the Fp32 tier, and APPROXIMATION_MODE only drops exp to the Bf16 tier.
+ *
+ * scale is 1/(sqrt(d_k) * softcap), so that the tanh argument costs a single multiply; scale and softcap are FP32 bit
+ * patterns. dst_index_out may alias dst_index_in. Requires _init_softmax_exponential_<APPROXIMATION_MODE, true>.
+ * Run with VectorMode::RC.
+ */
+template <bool APPROXIMATION_MODE, int ITERATIONS>
+inline void _calculate_softmax_exponential_softcap_(
+    const std::uint32_t dst_index_in, const std::uint32_t dst_index_max, const std::uint32_t dst_index_out, const std::uint32_t scale, const std::uint32_t softcap)
+{
+    // size of each tile in Dest is 64/SFP_DESTREG_STRIDE = 32 rows when using sfpi to load/store
+    constexpr std::uint32_t dst_tile_size_sfpi = 32;
+    constexpr SfpuAccuracy EXP_ACCURACY        = APPROXIMATION_MODE ? SfpuAccuracy::Bf16 : SfpuAccuracy::Fp32;
+
+    const sfpi::vFloat v_scale   = Converter::as_float(scale);
+    const sfpi::vFloat v_softcap = Converter::as_float(softcap);
+
+#pragma GCC unroll 0
+    for (int d = 0; d < ITERATIONS; d++)
+    {
+        sfpi::vFloat t     = _sfpu_tanh_tiered_<SfpuAccuracy::Fp32>(sfpi::dst_reg[dst_index_in * dst_tile_size_sfpi] * v_scale);
+        sfpi::vFloat t_max = _sfpu_tanh_tiered_<SfpuAccuracy::Fp32>(sfpi::dst_reg[dst_index_max * dst_tile_size_sfpi] * v_scale);
+        sfpi::dst_reg[dst_index_out * dst_tile_size_sfpi] = _sfpu_exp_tiered_<EXP_ACCURACY>((t - t_max) * v_softcap);
+        sfpi::dst_reg++;
+    }
+}
+
+template <bool APPROXIMATION_MODE, bool SOFTCAP_EN>
+inline void _init_softmax_exponential_()
+{
+    if constexpr (SOFTCAP_EN)
+    {
+        // The tiered tanh and exp only take the reciprocal constants
+        _init_sfpu_reciprocal_<false>();
+    }
+    else
+    {
+        const std::uint32_t EXP_BASE_SCALE_FACTOR = 0x3F800000;
+        const bool FAST_APPROX                    = false; // Scale is applied at runtime, the fast approximation bakes it into its macros
+        _init_exponential_<APPROXIMATION_MODE, FAST_APPROX, EXP_BASE_SCALE_FACTOR>();
+    }
+}
+
+/**
+ * @brief Streaming log-sum-exp over rows: folds one tile of logits into running per-row statistics.
+ *
+ * A large-vocabulary row does not fit in dest, so it is consumed one tile at a time with the online softmax update
+ *   m' = max(m, x),  s' = s * exp(m - m') + exp(x - m')
+ * The statistics are kept per lane column instead of per row, which keeps this pass purely element-wise; the 32
+ * partial maxima and sums of each row are combined once, by _calculate_logsumexp_finalize_.
+ *
+ * The state tile dst_index_state is carried across calls (pack/unpack it when it outlives a dest section):
+ *   left faces, even columns:  running max
+ *   right faces, even columns: running sum
+ *   left faces, odd columns:   target logit (NLL_EN only)
+ *   right faces, odd columns:  scratch for _calculate_logsumexp_finalize_
+ * first initializes the state from this tile instead of reading it.
+ *
+ * With NLL_EN, dst_index_target holds each row's target class index as a float broadcast along the row (unpack it
+ * with BroadcastType::COL), and col_offset is the class index of column 0 of the input tile. The target logit is
+ * picked out on the fly, so neither probabilities nor one-hot labels are ever materialized.
+ *
+ * Requires _init_logsumexp_. Run with VectorMode::None.
+ */
+template <bool APPROXIMATION_MODE, bool NLL_EN>
+inline void _calculate_logsumexp_accumulate_(
+    const std::uint32_t dst_index_in,
+    const std::uint32_t dst_index_state,
+    const bool first,
+    const std::uint32_t dst_index_target = 0,
+    const std::uint32_t col_offset       = 0)
+{
+    // size of each tile in Dest is 64/SFP_DESTREG_STRIDE = 32 rows when using sfpi to load/store
+    constexpr std::uint32_t dst_tile_size_sfpi = 32;
+    // Both exp arguments are differences to the running max and never positive
+    constexpr bool SKIP_POSITIVE_CHECK = true;
+
+    const std::uint32_t in_base     = dst_index_in * dst_tile_size_sfpi;
+    const std::uint32_t state_base  = dst_index_state * dst_tile_size_sfpi;
+    const std::uint32_t target_base = dst_index_target * dst_tile_size_sfpi;
+
+    // Class index of the element each lane loads from the even columns of the left face: the tile id constant holds
+    // 2 * lane, and the 8 lanes of each row cover every other column
+    sfpi::vFloat v_col = 0.0f;
+    if constexpr (NLL_EN)
+    {
+        v_col = sfpi::int32_to_float(sfpi::vConstTileId & 0xE, 0) + static_cast<float>(col_offset);
+    }
+
+#pragma GCC unroll 0
+    for (std::uint32_t g = 0; g < 8; g++)
+    {
+        const std::uint32_t e = SFPU_ROW_GROUP_OFFSETS[g];
+
+        sfpi::vFloat x0 = sfpi::dst_reg[in_base + e];
+        sfpi::vFloat x1 = sfpi::dst_reg[in_base + e + 1];
+        sfpi::vFloat x2 = sfpi::dst_reg[in_base + e + 8];
+        sfpi::vFloat x3 = sfpi::dst_reg[in_base + e + 9];
+
+        sfpi::vFloat max = x0;
+        v_if (x1 > max)
+        {
+            max = x1;
+        }
+        v_endif;
+        v_if (x2 > max)
+        {
+            max = x2;
+        }
+        v_endif;
+        v_if (x3 > max)
+        {
+            max = x3;
+        }
+        v_endif;
+
+        sfpi::vFloat sum = 0.0f;
+        if (!first)
+        {
+            sfpi::vFloat prev_max = sfpi::dst_reg[state_base + e];
+            v_if (prev_max > max)
+            {
+                max = prev_max;
+            }
+            v_endif;
+            sum = sfpi::dst_reg[state_base + e + 8] *
+                  _calculate_exponential_piecewise_<APPROXIMATION_MODE, false, SKIP_POSITIVE_CHECK>(prev_max - max, p_sfpu::kCONST_1_FP16B);
+        }
+
+        sum += _calculate_exponential_piecewise_<APPROXIMATION_MODE, false, SKIP_POSITIVE_CHECK>(x0 - max, p_sfpu::kCONST_1_FP16B);
+        sum += _calculate_exponential_piecewise_<APPROXIMATION_MODE, false, SKIP_POSITIVE_CHECK>(x1 - max, p_sfpu::kCONST_1_FP16B);
+        sum += _calculate_exponential_piecewise_<APPROXIMATION_MODE, false, SKIP_POSITIVE_CHECK>(x2 - max, p_sfpu::kCONST_1_FP16B);
+        sum += _calculate_exponential_piecewise_<APPROXIMATION_MODE, false, SKIP_POSITIVE_CHECK>(x3 - max, p_sfpu::kCONST_1_FP16B);
+
+        sfpi::dst_reg[state_base + e]     = max;
+        sfpi::dst_reg[state_base + e + 8] = sum;
+
+        if constexpr (NLL_EN)
+        {
+            sfpi::vFloat target_logit = 0.0f;
+            if (!first)
+            {
+                target_logit = sfpi::dst_reg[state_base + e + 1];
+            }
+
+            // Position of the target relative to this lane's even left-face column; exact for class indices below 2^24
+            sfpi::vFloat target = sfpi::dst_reg[target_base + e] - v_col;
+            v_if (target == 0.0f)
+            {
+                target_logit = x0;
+            }
+            v_elseif (target == 1.0f)
+            {
+                target_logit = x1;
+            }
+            v_elseif (target == 16.0f)
+            {
+                target_logit = x2;
+            }
+            v_elseif (target == 17.0f)
+            {
+                target_logit = x3;
+            }
+            v_endif;
+
+            sfpi::dst_reg[state_base + e + 1] = target_logit;
+        }
+    }
+}
+
+/**
+ * @brief Combines the per-lane statistics of _calculate_logsumexp_accumulate_ into one result per row.
+ *
+ * Writes logsumexp(row) to every element of the row in dst_index_out or, with NLL_EN, the negative log-likelihood
+ * logsumexp(row) - x[target]. Column 0 of the packed tile is then the per-row loss. The state tile is clobbered.
+ *
+ * The log uses _calculate_log_body_no_init_, which leaves the programmable constants of the exp init untouched.
+ * Requires _init_logsumexp_. Run with VectorMode::None.
+ */
+template <bool APPROXIMATION_MODE, bool NLL_EN>
+inline void _calculate_logsumexp_finalize_(const std::uint32_t dst_index_state, const std::uint32_t dst_index_out)
+{
+    // size of each tile in Dest is 64/SFP_DESTREG_STRIDE = 32 rows when using sfpi to load/store
+    constexpr std::uint32_t dst_tile_size_sfpi = 32;
+    constexpr std::uint32_t dst_tile_size_raw  = 64;
+    constexpr bool SKIP_POSITIVE_CHECK         = true;
+    // Raw dest addresses of the group pairs processed by _sfpu_row_allreduce_x2_: rows 0-7, 8-15, 16-23, 24-31
+    constexpr std::uint32_t GROUP_PAIR_ADDRS[4] = {0, 8, 32, 40};
+
+    const std::uint32_t state_base     = dst_index_state * dst_tile_size_sfpi;
+    const std::uint32_t out_base       = dst_index_out * dst_tile_size_sfpi;
+    const std::uint32_t state_base_raw = dst_index_state * dst_tile_size_raw;
+
+    // Row max of the per-lane maxima, into the scratch columns
+    for (std::uint32_t p = 0; p < 4; p++)
+    {
+        const std::uint32_t addr = state_base_raw + GROUP_PAIR_ADDRS[p];
+        _sfpu_row_allreduce_x2_<true>(addr, addr + 16 + 2);
+    }
+
+    // Rescale the per-lane sums to the row max
+#pragma GCC unroll 0
+    for (std::uint32_t g = 0; g < 8; g++)
+    {
+        const std::uint32_t e = SFPU_ROW_GROUP_OFFSETS[g];
+
+        sfpi::vFloat lane_max = sfpi::dst_reg[state_base + e];
+        sfpi::vFloat row_max  = sfpi::dst_reg[state_base + e + 9];
+        sfpi::dst_reg[state_base + e + 8] =
+            sfpi::dst_reg[state_base + e + 8] *
+            _calculate_exponential_piecewise_<APPROXIMATION_MODE, false, SKIP_POSITIVE_CHECK>(lane_max - row_max, p_sfpu::kCONST_1_FP16B);
+    }
+
+    // Row sum of the rescaled sums; only one lane of each row holds a non-zero target logit, so a sum picks it out
+    for (std::uint32_t p = 0; p < 4; p++)
+    {
+        const std::uint32_t addr = state_base_raw + GROUP_PAIR_ADDRS[p];
+        _sfpu_row_allreduce_x2_<false>(addr + 16, addr + 16);
+        if constexpr (NLL_EN)
+        {
+            _sfpu_row_allreduce_x2_<false>(addr + 2, addr + 2);
+        }
+    }
+
+#pragma GCC unroll 0
+    for (std::uint32_t g = 0; g < 8; g++)
+    {
+        const std::uint32_t e = SFPU_ROW_GROUP_OFFSETS[g];
+
+        sfpi::vFloat result = sfpi::dst_reg[state_base + e + 9] + _calculate_log_body_no_init_(sfpi::dst_reg[state_base + e + 8]);
+        if constexpr (NLL_EN)
+        {
+            result -= sfpi::dst_reg[state_base + e + 1];
+        }
+
+        sfpi::dst_reg[out_base + e]     = result;
+        sfpi::dst_reg[out_base + e + 1] = result;
+        sfpi::dst_reg[out_base + e + 8] = result;
+        sfpi::dst_reg[out_base + e + 9] = result;
+    }
+}
+
+/**
+ * @brief Log-softmax: out = x - logsumexp(row), with dst_index_lse holding the output of
+ * _calculate_logsumexp_finalize_<APPROXIMATION_MODE, false>.
+ *
+ * A second pass over the logits, only needed when the log-probabilities themselves are consumed; the loss alone comes
+ * straight out of the finalize step. dst_index_out may alias dst_index_in. Run with VectorMode::RC.
+ */
+template <bool APPROXIMATION_MODE, int ITERATIONS = 8>
+inline void _calculate_log_softmax_(const std::uint32_t dst_index_in, const std::uint32_t dst_index_lse, const std::uint32_t dst_index_out)
+{
+    // size of each tile in Dest is 64/SFP_DESTREG_STRIDE = 32 rows when using sfpi to load/store
+    constexpr std::uint32_t dst_tile_size_sfpi = 32;
+
+#pragma GCC unroll 8
+    for (int d = 0; d < ITERATIONS; d++)
+    {
+        sfpi::dst_reg[dst_index_out * dst_tile_size_sfpi] =
+            sfpi::dst_reg[dst_index_in * dst_tile_size_sfpi] - sfpi::dst_reg[dst_index_lse * dst_tile_size_sfpi];
+        sfpi::dst_reg++;
+    }
+}
+
+template <bool APPROXIMATION_MODE>
+inline void _init_logsumexp_()
+{
+    _init_softmax_exponential_<APPROXIMATION_MODE, false>();
+    // Reset the SFPSWAP direction, which a preceding MIN reduction may have inverted
+    _init_sfpu_config_reg();
+}
+
+} // namespace ckernel::sfpu
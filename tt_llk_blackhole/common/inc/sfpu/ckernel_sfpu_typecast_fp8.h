@@ -0,0 +1,171 @@
+// SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+
+#include "ckernel.h"
+#include "llk_defs.h"
+#include "sfpi.h"
+
+namespace ckernel
+{
+namespace sfpu
+{
+
+/**
+ * FP8 typecasts
+ *
+ * The packer and unpacker have no FP8 formats, so FP8 tiles are kept in L1 as UInt8 datums holding the FP8 bit
+ * patterns. In dest the codes are int32 values in [0, 255]: _calculate_typecast_fp32_to_fp8_ writes them in place of
+ * the fp32 input, ready to be packed with UInt8 as the pack destination format, and _calculate_typecast_fp8_to_fp32_
+ * turns codes unpacked from a UInt8 tile (unsigned, dest in 32-bit mode) back to fp32. Bf16 data goes through the
+ * same fp32 view of dest.
+ */
+template <Fp8Format FORMAT>
+struct Fp8FormatTraits;
+
+template <>
+struct Fp8FormatTraits<Fp8Format::E4M3>
+{
+    static constexpr int MAN_BITS                 = 3;
+    static constexpr int BIAS                     = 7;
+    static constexpr std::int32_t MAX_CODE        = 0x7E;       // 448
+    static constexpr std::int32_t MIN_NORMAL_BITS = 0x3C800000; // 2^-6
+    static constexpr float SUBNORMAL_SCALE        = 512.0f;     // 2^9, subnormal code = |x| * SUBNORMAL_SCALE
+};
+
+template <>
+struct Fp8FormatTraits<Fp8Format::E5M2>
+{
+    static constexpr int MAN_BITS                 = 2;
+    static constexpr int BIAS                     = 15;
+    static constexpr std::int32_t MAX_CODE        = 0x7B;       // 57344
+    static constexpr std::int32_t MIN_NORMAL_BITS = 0x38800000; // 2^-14
+    static constexpr float SUBNORMAL_SCALE        = 65536.0f;   // 2^16, subnormal code = |x| * SUBNORMAL_SCALE
+};
+
+constexpr std::int32_t FP8_NAN_CODE  = 0x7F;
+constexpr std::int32_t FP8_SIGN_CODE = 0x80;
+
+/**
+ * @brief Converts fp32 in dest to FP8 codes, rounding to nearest even and saturating to the largest finite value
+ *
+ * Infinities saturate as well, NaNs become the FP8 NaN code.
+ */
+template <bool APPROXIMATION_MODE, int ITERATIONS, Fp8Format FORMAT>
+inline void _calculate_typecast_fp32_to_fp8_()
+{
+    using traits               = Fp8FormatTraits<FORMAT>;
+    constexpr int SHIFT        = 23 - traits::MAN_BITS;
+    constexpr int EXP_REBIAS   = (127 - traits::BIAS) << traits::MAN_BITS;
+    constexpr int ROUND_OFFSET = (1 << (SHIFT - 1)) - 1;
+
+#pragma GCC unroll 0
+    for (int d = 0; d < ITERATIONS; d++)
+    {
+        sfpi::vFloat in  = sfpi::dst_reg[0];
+        sfpi::vInt bits  = sfpi::reinterpret<sfpi::vInt>(in);
+        sfpi::vFloat mag = sfpi::setsgn(in, 0);
+        sfpi::vInt a     = sfpi::reinterpret<sfpi::vInt>(mag);
+        sfpi::vInt code;
+
+        v_if (a < traits::MIN_NORMAL_BITS)
+        {
+            // The scaled value is below 2^MAN_BITS, the SFPU rounds it to an integer (rounding up to the smallest
+            // normal code where needed)
+            code = sfpi::float_to_int16(mag * traits::SUBNORMAL_SCALE, 0);
+        }
+        v_else
+        {
+            // Round the mantissa to MAN_BITS in the integer domain, a carry out of the mantissa bumps the exponent
+            sfpi::vUInt u   = sfpi::reinterpret<sfpi::vUInt>(a);
+            sfpi::vUInt lsb = (u >> SHIFT) & 1;
+            code            = sfpi::reinterpret<sfpi::vInt>((u + ROUND_OFFSET + lsb) >> SHIFT) - EXP_REBIAS;
+            v_if (code > traits::MAX_CODE)
+            {
+                code = traits::MAX_CODE;
+            }
+            v_endif;
+            v_if (a > 0x7F800000)
+            {
+                code = FP8_NAN_CODE;
+            }
+            v_endif;
+        }
+        v_endif;
+
+        v_if (bits < 0)
+        {
+            code |= FP8_SIGN_CODE;
+        }
+        v_endif;
+
+        sfpi::dst_reg[0] = code;
+        sfpi::dst_reg++;
+    }
+}
+
+/**
+ * @brief Converts FP8 codes in dest to fp32, exactly
+ */
+template <bool APPROXIMATION_MODE, int ITERATIONS, Fp8Format FORMAT>
+inline void _calculate_typecast_fp8_to_fp32_()
+{
+    using traits             = Fp8FormatTraits<FORMAT>;
+    constexpr int SHIFT      = 23 - traits::MAN_BITS;
+    constexpr int EXP_REBIAS = (127 - traits::BIAS) << 23;
+
+#pragma GCC unroll 0
+    for (int d = 0; d < ITERATIONS; d++)
+    {
+        sfpi::vInt code = sfpi::dst_reg[0];
+        sfpi::vInt mag  = code & 0x7F;
+        sfpi::vFloat out;
+
+        v_if (mag < (1 << traits::MAN_BITS))
+        {
+            out = sfpi::int32_to_float(mag, 0) * (1.0f / traits::SUBNORMAL_SCALE);
+        }
+        v_else
+        {
+            out = sfpi::reinterpret<sfpi::vFloat>((mag << SHIFT) + EXP_REBIAS);
+        }
+        v_endif;
+
+        if constexpr (FORMAT == Fp8Format::E4M3)
+        {
+            v_if (mag == FP8_NAN_CODE)
+            {
+                out = sfpi::reinterpret<sfpi::vFloat>(sfpi::vInt(0x7FC00000));
+            }
+            v_endif;
+        }
+        else
+        {
+            v_if (mag == 0x7C)
+            {
+                out = sfpi::reinterpret<sfpi::vFloat>(sfpi::vInt(0x7F800000));
+            }
+            v_elseif (mag > 0x7C)
+            {
+                out = sfpi::reinterpret<sfpi::vFloat>(sfpi::vInt(0x7FC00000));
+            }
+            v_endif;
+        }
+
+        v_if ((code & FP8_SIGN_CODE) != 0)
+        {
+            out = sfpi::setsgn(out, 1);
+        }
+        v_endif;
+
+        sfpi::dst_reg[0] = out;
+        sfpi::dst_reg++;
+    }
+}
+
+} // namespace sfpu
+} // namespace ckernel
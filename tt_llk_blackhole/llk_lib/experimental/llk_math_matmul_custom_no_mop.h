@@ -129,7 +129,7 @@ inline void matmul_configure_addrmod_reinit(const bool transpose = false)
     matmul_configure_addrmod<math_fidelity, THROTTLE_LEVEL>(transpose);
 }
 
-template <MathFidelity math_fidelity>
+template <MathFidelity math_fidelity, MatmulReuse reuse = MatmulReuse::Auto>
 inline void matmul_configure_mop(
     const std::uint32_t ct_dim,
     const std::uint32_t rt_dim,
@@ -150,7 +150,7 @@ inline void matmul_configure_mop(
     constexpr int num_fidelity_phases = get_math_num_fidelity_phases(math_fidelity);
     constexpr bool high_fidelity      = math_fidelity != MathFidelity::LoFi;
 
-    const bool reuse_a        = ct_dim >= rt_dim;
+    const bool reuse_a        = is_matmul_reuse_a(reuse, ct_dim, rt_dim);
     const std::uint32_t t_dim = reuse_a ? rt_dim : ct_dim;
 
     const std::uint32_t replay_buf_len = 16;
@@ -297,7 +297,7 @@ void run_throttled_sequence_no_mop<5>()
  * Level 4: throttle to 40% of max
  * Level 5: throttle to 33% of max
  */
-template <MathFidelity math_fidelity, int THROTTLE_LEVEL>
+template <MathFidelity math_fidelity, int THROTTLE_LEVEL, MatmulReuse reuse = MatmulReuse::Auto>
 inline void matmul_configure_mop_throttled(
     const std::uint32_t ct_dim,
     const std::uint32_t rt_dim,
@@ -322,7 +322,7 @@ inline void matmul_configure_mop_throttled(
         (in0_tile_r_dim == TILE_R_DIM) && (in0_tile_c_dim == TILE_C_DIM) && (in1_tile_r_dim == TILE_R_DIM) && (in1_tile_c_dim == TILE_C_DIM) && !partial_face,
         "MM throttling only enabled for full 32x32 tile size");
 
-    const bool reuse_a = ct_dim >= rt_dim;
+    const bool reuse_a = is_matmul_reuse_a(reuse, ct_dim, rt_dim);
 
     constexpr std::uint32_t replay_buf_len = (THROTTLE_LEVEL > 3) ? (1 + THROTTLE_LEVEL * 2) : ((THROTTLE_LEVEL > 1) ? (3 + THROTTLE_LEVEL * 4) : 10);
 
@@ -335,7 +335,7 @@ inline void matmul_configure_mop_throttled(
     // MOP template programming removed - will use direct replay calls
 }
 
-template <MathFidelity math_fidelity, int THROTTLE_LEVEL = 0>
+template <MathFidelity math_fidelity, int THROTTLE_LEVEL = 0, MatmulReuse reuse = MatmulReuse::Auto>
 inline void _llk_math_matmul_init_no_mop_(
     const std::uint32_t in0_tile_r_dim = TILE_R_DIM,
     const std::uint32_t in0_tile_c_dim = TILE_C_DIM,
@@ -349,12 +349,12 @@ inline void _llk_math_matmul_init_no_mop_(
     matmul_configure_addrmod<math_fidelity, THROTTLE_LEVEL>(transpose, in0_tile_r_dim, in0_tile_c_dim, in1_tile_r_dim, in1_tile_c_dim, partial_face);
     if constexpr (THROTTLE_LEVEL > 0)
     {
-        matmul_configure_mop_throttled<math_fidelity, THROTTLE_LEVEL>(
+        matmul_configure_mop_throttled<math_fidelity, THROTTLE_LEVEL, reuse>(
             ct_dim, rt_dim, in0_tile_r_dim, in0_tile_c_dim, in1_tile_r_dim, in1_tile_c_dim, partial_face);
     }
     else
     {
-        matmul_configure_mop<math_fidelity>(ct_dim, rt_dim, in0_tile_r_dim, in0_tile_c_dim, in1_tile_r_dim, in1_tile_c_dim, partial_face);
+        matmul_configure_mop<math_fidelity, reuse>(ct_dim, rt_dim, in0_tile_r_dim, in0_tile_c_dim, in1_tile_r_dim, in1_tile_c_dim, partial_face);
     }
     math::reset_counters(p_setrwc::SET_ABD_F);
 }
@@ -364,7 +364,7 @@ inline void _llk_math_matmul_uninit_no_mop_()
     // No state to restore - all states are transient or default
 }
 
-template <MathFidelity math_fidelity, int THROTTLE_LEVEL = 0>
+template <MathFidelity math_fidelity, int THROTTLE_LEVEL = 0, MatmulReuse reuse = MatmulReuse::Auto>
 inline void _llk_math_matmul_no_mop_(
     std::uint32_t dst_index,
     const std::uint32_t ct_dim         = 1,
@@ -375,7 +375,7 @@ inline void _llk_math_matmul_no_mop_(
     const std::uint32_t in1_tile_c_dim = TILE_C_DIM,
     const bool partial_face            = false)
 {
-    const bool reuse_a                = ct_dim >= rt_dim;
+    const bool reuse_a                = is_matmul_reuse_a(reuse, ct_dim, rt_dim);
     const std::uint32_t t_dim         = reuse_a ? rt_dim : ct_dim;
     const std::uint32_t rut_dim       = reuse_a ? ct_dim : rt_dim; // reuse-dim
     constexpr int num_fidelity_phases = get_math_num_fidelity_phases(math_fidelity);
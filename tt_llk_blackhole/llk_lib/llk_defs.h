@@ -121,9 +121,79 @@ enum class MathFidelity : std::uint8_t
     HiFi4 = 4
 };
 
+/*
+Matmul operand reuse: which input stays resident in its source register while the other one is streamed.
+    Auto: in0 is reused when ct_dim >= rt_dim, in1 otherwise.
+    In0:  in0 (srcB) is reused, in1 tiles are streamed along ct_dim.
+    In1:  in1 (srcA) is reused, in0 tiles are streamed along rt_dim. Used for grouped-query attention: the G query heads
+          of a group are stacked along rt_dim, so each K/V tile is unpacked once and shared by all of them.
+*/
+enum class MatmulReuse : std::uint8_t
+{
+    Auto = 0,
+    In0  = 1,
+    In1  = 2,
+};
+
+constexpr bool is_matmul_reuse_a(const MatmulReuse reuse, const std::uint32_t ct_dim, const std::uint32_t rt_dim)
+{
+    return (reuse == MatmulReuse::Auto) ? (ct_dim >= rt_dim) : (reuse == MatmulReuse::In0);
+}
+
+/*
+SFPU accuracy tiers, one knob for the accuracy/speed trade-off of the unary SFPU ops (ckernel_sfpu_accuracy.h):
+    Fp32:       fp32-grade results where the op has such an implementation; refinement steps sized for fp32.
+    Bf16:       results accurate to bf16 rounding; polynomials and refinement steps sized for bf16.
+    FastApprox: the op's approximation mode (LUTs, single-step estimates); lowest cost, a few bf16 ulp of error.
+*/
+enum class SfpuAccuracy : std::uint8_t
+{
+    Fp32       = 0,
+    Bf16       = 1,
+    FastApprox = 2,
+};
+
+constexpr bool is_sfpu_approx(const SfpuAccuracy accuracy)
+{
+    return accuracy == SfpuAccuracy::FastApprox;
+}
+
+/*
+OCP 8-bit float formats, see ckernel_sfpu_typecast_fp8.h:
+    E4M3: 4 exponent bits, 3 mantissa bits, bias 7. No infinities, S.1111.111 is NaN, largest finite value 448.
+    E5M2: 5 exponent bits, 2 mantissa bits, bias 15. IEEE-like, S.11111.00 is infinity, largest finite value 57344.
+*/
+enum class Fp8Format : std::uint8_t
+{
+    E4M3 = 0,
+    E5M2 = 1,
+};
+
+/*
+OCP MX block formats dequantized on the SFPU, see ckernel_sfpu_mx.h. Each block of MX_BLOCK_SIZE elements shares one
+E8M0 scale (2^(s - 127), 0xFF is NaN). Elements are bit-packed into UInt32 tiles, 4, 6 or 8 bits each:
+    MxFp4:     E2M1, bias 1, largest value 6.
+    MxFp6E2M3: E2M3, bias 1, largest value 7.5.
+    MxFp6E3M2: E3M2, bias 3, largest value 28.
+    MxInt8:    two's complement with 6 fraction bits, values in [-2, 2).
+*/
+enum class MxFormat : std::uint8_t
+{
+    MxFp4     = 0,
+    MxFp6E2M3 = 1,
+    MxFp6E3M2 = 2,
+    MxInt8    = 3,
+};
+
+constexpr std::uint32_t MX_BLOCK_SIZE = 32;
+
 constexpr bool UnpackToDestEn  = true;
 constexpr bool UnpackToDestDis = false;
 
+// Sparse tiles start with a header of one L1 word whose first uint32 is the bitmap of stored faces,
+// see _llk_pack_sparse_ and _llk_unpack_A_sparse_
+constexpr std::uint32_t SPARSE_TILE_HEADER_SIZE = 16;
+
 /*
 Stochastic rounding modes:
     None: No stochastic rounding enabled, default rounding is round to nearest even.
@@ -0,0 +1,75 @@
+// SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+
+#include "ckernel_globals.h"
+#include "ckernel_include.h"
+#include "ckernel_ops.h"
+#include "cmath_common.h"
+#include "llk_assert.h"
+#include "llk_math_common.h"
+
+using namespace ckernel;
+
+/**
+ * Math side of convert_tiles, see llk_unpack_convert_tiles.h
+ *
+ * The unpacker writes the tiles to dest itself, so math moves no data. It only waits for its previous work to drain,
+ * tells the unpacker where in dest the block starts, waits for the block to land there and clears the dest zero flags
+ * of the block, after which the dest section is handed to the packer as usual with _llk_math_dest_section_done_.
+ */
+
+/**
+ * @brief Initializes math for convert_tiles
+ */
+inline void _llk_math_convert_tiles_init_()
+{
+    addr_mod_t {
+        .srca = {.incr = 0},
+        .srcb = {.incr = 0},
+        .dest = {.incr = 0},
+    }
+        .set(ADDR_MOD_3);
+
+    math::reset_counters(p_setrwc::SET_ABD_F);
+}
+
+/**
+ * @brief Hands dest over to the unpacker for one block of convert_tiles
+ *
+ * Must be paired with one _llk_unpack_convert_tiles_ call on the unpack thread.
+ *
+ * @param dst_index Dest tile where the block starts
+ * @param num_tiles Number of tiles in the block, as passed to _llk_unpack_convert_tiles_init_
+ * @param num_faces Number of faces per tile
+ */
+template <DstSync Dst, bool is_fp32_dest_acc_en>
+inline void _llk_math_convert_tiles_(const std::uint32_t dst_index, const std::uint32_t num_tiles = 1, const std::uint32_t num_faces = 4)
+{
+    static_assert(is_fp32_dest_acc_en, "convert_tiles unpacks 32-bit data to dest, which requires dest in 32-bit mode");
+    LLK_ASSERT(num_faces == 1 || num_faces == 2 || num_faces == 4, "num_faces must be 1, 2, or 4");
+    LLK_ASSERT(
+        (dst_index + num_tiles <= get_dest_max_tiles<Dst, is_fp32_dest_acc_en, DstTileShape::Tile32x32>()), "Block exceeds the dest tiles available to math");
+
+    math_unpack_to_dest_math_ready();
+    math::set_dst_write_addr<DstTileShape::Tile32x32, UnpackDestination::DestReg>(dst_index);
+    math::math_unpack_to_dest_tile_ready();
+
+    // Unpack to dest can drop the clearing of dest zero flags when it lands in the same cycle as a packer ZEROACC
+    // (budabackend/#2730), so clear them again for every face of the block, as _llk_math_eltwise_unary_datacopy_ does.
+    constexpr std::uint32_t tiles_per_bank = 4;
+#pragma GCC unroll 0
+    for (std::uint32_t t = 0; t < num_tiles; t++)
+    {
+        const std::uint32_t local_tile = (dst_index + t) & (tiles_per_bank - 1);
+#pragma GCC unroll 0
+        for (std::uint32_t i = 0; i < num_faces; i++)
+        {
+            TT_ZEROACC(p_zeroacc::CLR_16, 1 /*fp32*/, 1 /*clear zero flags*/, ADDR_MOD_3, get_dest_index_in_faces(local_tile, i));
+        }
+    }
+}
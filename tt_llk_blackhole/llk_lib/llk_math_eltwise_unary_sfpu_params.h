@@ -9,6 +9,7 @@
 #include "llk_assert.h"
 #include "llk_math_eltwise_unary_sfpu.h"
 #include "llk_sfpu_types.h"
+#include "sfpu/ckernel_sfpu_chain.h"
 
 template <bool APPROXIMATE, typename Callable, typename... Args>
 inline void _llk_math_eltwise_unary_sfpu_params_(
@@ -62,3 +63,15 @@ inline void _llk_math_eltwise_unary_sfpu_params_(
     }
     _llk_math_eltwise_unary_sfpu_done_();
 }
+
+/**
+ * @brief Runs a chain of per-element SFPU links (see ckernel_sfpu_chain.h) over dest tile dst_index.
+ *
+ * Each row group is loaded once, passed through every link in order with the intermediates kept in LREGs, and
+ * stored once. APPROXIMATE is passed on to every link. Initialize with ckernel::sfpu::_init_sfpu_chain_<APPROXIMATE, Links...>().
+ */
+template <bool APPROXIMATE, int ITERATIONS = 8, template <bool> class... Links>
+inline void _llk_math_eltwise_unary_sfpu_chain_params_(std::uint32_t dst_index, int vector_mode = static_cast<int>(VectorMode::RC))
+{
+    _llk_math_eltwise_unary_sfpu_params_<APPROXIMATE>(ckernel::sfpu::_calculate_sfpu_chain_<APPROXIMATE, ITERATIONS, Links...>, dst_index, vector_mode);
+}
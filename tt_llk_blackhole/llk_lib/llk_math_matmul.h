@@ -272,7 +272,7 @@ inline void matmul_configure_addrmod(
     }
 }
 
-template <MathFidelity math_fidelity>
+template <MathFidelity math_fidelity, MatmulReuse reuse = MatmulReuse::Auto>
 inline void matmul_configure_mop(
     const std::uint32_t ct_dim,
     const std::uint32_t rt_dim,
@@ -291,7 +291,7 @@ inline void matmul_configure_mop(
     // if col major layout faces are ordered as f0,f2,f1,f3
     constexpr bool high_fidelity = is_high_fidelity(math_fidelity);
 
-    const bool reuse_a        = ct_dim >= rt_dim;
+    const bool reuse_a        = is_matmul_reuse_a(reuse, ct_dim, rt_dim);
     const std::uint32_t t_dim = reuse_a ? rt_dim : ct_dim;
 
     const bool is_in0_16x32 = (in0_tile_r_dim <= FACE_R_DIM) && (in0_tile_c_dim > FACE_C_DIM);
@@ -507,7 +507,7 @@ void run_throttled_sequence<5>()
  * Level 4: throttle to 40% of max
  * Level 5: throttle to 33% of max
  */
-template <MathFidelity math_fidelity, int THROTTLE_LEVEL>
+template <MathFidelity math_fidelity, int THROTTLE_LEVEL, MatmulReuse reuse = MatmulReuse::Auto>
 inline void matmul_configure_mop_throttled(
     const std::uint32_t ct_dim,
     const std::uint32_t rt_dim,
@@ -530,7 +530,7 @@ inline void matmul_configure_mop_throttled(
         (in0_tile_r_dim == TILE_R_DIM) && (in0_tile_c_dim == TILE_C_DIM) && (in1_tile_r_dim == TILE_R_DIM) && (in1_tile_c_dim == TILE_C_DIM) && !partial_face,
         "MM throttling only enabled for full 32x32 tile size");
 
-    const bool reuse_a = ct_dim >= rt_dim;
+    const bool reuse_a = is_matmul_reuse_a(reuse, ct_dim, rt_dim);
 
     const bool is_in0_16x32 = (in0_tile_r_dim <= FACE_R_DIM) && (in0_tile_c_dim > FACE_C_DIM);
     const bool is_in1_32x16 = (in1_tile_r_dim > FACE_R_DIM) && (in1_tile_c_dim <= FACE_C_DIM);
@@ -588,7 +588,7 @@ inline void matmul_configure_mop_throttled(
     tmp.program();
 }
 
-template <MathFidelity math_fidelity, int THROTTLE_LEVEL = 0>
+template <MathFidelity math_fidelity, int THROTTLE_LEVEL = 0, MatmulReuse reuse = MatmulReuse::Auto>
 inline void _llk_math_matmul_init_(
     const std::uint32_t in0_tile_r_dim = TILE_R_DIM,
     const std::uint32_t in0_tile_c_dim = TILE_C_DIM,
@@ -610,12 +610,12 @@ inline void _llk_math_matmul_init_(
 
     if constexpr (THROTTLE_LEVEL > 0)
     {
-        matmul_configure_mop_throttled<math_fidelity, THROTTLE_LEVEL>(
+        matmul_configure_mop_throttled<math_fidelity, THROTTLE_LEVEL, reuse>(
             ct_dim, rt_dim, in0_tile_r_dim, in0_tile_c_dim, in1_tile_r_dim, in1_tile_c_dim, partial_face);
     }
     else
     {
-        matmul_configure_mop<math_fidelity>(ct_dim, rt_dim, in0_tile_r_dim, in0_tile_c_dim, in1_tile_r_dim, in1_tile_c_dim, partial_face);
+        matmul_configure_mop<math_fidelity, reuse>(ct_dim, rt_dim, in0_tile_r_dim, in0_tile_c_dim, in1_tile_r_dim, in1_tile_c_dim, partial_face);
     }
     math::reset_counters(p_setrwc::SET_ABD_F);
 }
@@ -625,10 +625,10 @@ inline void _llk_math_matmul_uninit_()
     // No state to restore - all states are transient or default
 }
 
-template <MathFidelity math_fidelity, int THROTTLE_LEVEL = 0>
+template <MathFidelity math_fidelity, int THROTTLE_LEVEL = 0, MatmulReuse reuse = MatmulReuse::Auto>
 inline void _llk_math_matmul_(std::uint32_t dst_index, const std::uint32_t ct_dim = 1, const std::uint32_t rt_dim = 1)
 {
-    const bool reuse_a           = ct_dim >= rt_dim;
+    const bool reuse_a           = is_matmul_reuse_a(reuse, ct_dim, rt_dim);
     const std::uint32_t t_dim    = reuse_a ? rt_dim : ct_dim;
     const std::uint32_t rut_dim  = reuse_a ? ct_dim : rt_dim; // reuse-dim
     constexpr bool high_fidelity = is_high_fidelity(math_fidelity);
@@ -315,7 +315,13 @@ inline void _llk_pack_mop_config_(
     }
 }
 
-template <bool is_fp32_dest_acc_en, bool is_tile_dim_reconfig_en = false>
+// is_stoch_rnd_reconfig_en reprograms the rounding of the conversions out of dest to stoch_rnd_mode, see
+// _llk_pack_configure_stoch_rnd_, so None goes back to round to nearest even. Otherwise the rounding is left as it was.
+template <
+    bool is_fp32_dest_acc_en,
+    bool is_tile_dim_reconfig_en  = false,
+    bool is_stoch_rnd_reconfig_en = false,
+    StochRndType stoch_rnd_mode   = StochRndType::None>
 inline void _llk_pack_reconfig_data_format_(
     const std::uint32_t pack_src_format,
     const std::uint32_t pack_dst_format,
@@ -330,6 +336,11 @@ inline void _llk_pack_reconfig_data_format_(
     LLK_ASSERT(num_faces == 1 || num_faces == 2 || num_faces == 4, "num_faces must be 1, 2, or 4");
     reconfig_packer_data_format<is_fp32_dest_acc_en>(pack_src_format, pack_dst_format, tile_size, face_r_dim, tile_c_dim, num_faces, partial_face);
 
+    if constexpr (is_stoch_rnd_reconfig_en)
+    {
+        _llk_pack_configure_stoch_rnd_<stoch_rnd_mode>();
+    }
+
     if constexpr (is_tile_dim_reconfig_en)
     {
         _llk_pack_mop_config_<false, false>(pack_dst_format, face_r_dim, tile_c_dim, num_faces, partial_face, narrow_tile, num_tiles);
@@ -415,4 +426,108 @@ inline void _llk_pack_(const std::uint32_t tile_index, const std::uint32_t addre
     TT_SETADCZW(p_setadc::PAC, 0, 0, 0, 0, 0b0101); // reset z counters
 }
 
+/*************************************************************************
+ * LLK PACK TRANSPOSE FACES
+ * Makes _llk_pack_ write faces 0, 2, 1, 3 of the dest tile to faces 0, 1, 2, 3 in L1
+ * The face counter (ch0 Z) only steps forward, so each of the two outer MOP iterations packs faces z and z + 2 from one
+ * face recorded in the replay buffer, and the end op sets Z back to 1; the L1 side (ch1 Y) keeps advancing as for a plain pack
+ * Combined with _llk_math_transpose_dest_<is_fp32_dest_acc_en, false, is_32bit> (within face transpose only) this gives
+ * a full 32x32 tile transpose, with math skipping the face swap
+ * 16x32 and 16x16 tiles keep their face order when transposed, so only num_faces == 4 changes anything
+ * Must be followed by _llk_pack_transpose_faces_uninit_ before packing untransposed tiles
+ *************************************************************************/
+
+inline void _llk_pack_transpose_faces_init_(const std::uint32_t face_r_dim = FACE_R_DIM, const std::uint32_t num_faces = 4)
+{
+    LLK_ASSERT(num_faces == 1 || num_faces == 2 || num_faces == 4, "num_faces must be 1, 2, or 4");
+    if (num_faces != 4)
+    {
+        return;
+    }
+    LLK_ASSERT(face_r_dim == FACE_R_DIM, "Transposing faces requires full 16x16 faces");
+
+    _llk_pack_configure_addrmod_<false, false>();
+
+    // Two copies of one face (4 PACRs of 4 rows): the first moves on to the next face in L1 and dest (ADDR_MOD_2 steps
+    // ch0 Z by one), the second closes the tile. Slots 16 onwards are left to replay_buf_offset users.
+    constexpr std::uint32_t face_len = FACE_R_DIM / 4;
+    static_assert(2 * face_len <= ckernel::packer::replay_buf_offset, "Face transpose replay overlaps replay_buf_offset");
+    load_replay_buf(
+        0,
+        2 * face_len,
+        []
+        {
+            for (std::uint32_t copy = 0; copy < 2; copy++)
+            {
+                for (std::uint32_t r = 0; r < face_len - 1; r++)
+                {
+                TTI_PACR(
+                    p_pacr::CFG_CTXT_0,
+                    p_pacr::NO_ROW_PAD_ZERO,
+                    p_pacr::DST_ACCESS_NORMAL_MODE,
+                    ADDR_MOD_0,
+                    p_pacr::ADDR_CNT_CTXT_0,
+                    p_pacr::P_ZERO_OUTPUT_DISABLED,
+                    p_pacr::ALL_INTF_ACTIVE,
+                    0,
+                    0,
+                    0,
+                    0,
+                    0);
+                }
+                if (copy == 0)
+                {
+                TTI_PACR(
+                    p_pacr::CFG_CTXT_0,
+                    p_pacr::NO_ROW_PAD_ZERO,
+                    p_pacr::DST_ACCESS_NORMAL_MODE,
+                    ADDR_MOD_2,
+                    p_pacr::ADDR_CNT_CTXT_0,
+                    p_pacr::P_ZERO_OUTPUT_DISABLED,
+                    p_pacr::ALL_INTF_ACTIVE,
+                    0,
+                    0,
+                    0,
+                    0,
+                    0);
+                }
+                else
+                {
+                TTI_PACR(
+                    p_pacr::CFG_CTXT_0,
+                    p_pacr::NO_ROW_PAD_ZERO,
+                    p_pacr::DST_ACCESS_NORMAL_MODE,
+                    ADDR_MOD_1,
+                    p_pacr::ADDR_CNT_CTXT_0,
+                    p_pacr::P_ZERO_OUTPUT_DISABLED,
+                    p_pacr::ALL_INTF_ACTIVE,
+                    0,
+                    0,
+                    0,
+                    0,
+                    1);
+                }
+            }
+        });
+
+    // Each outer iteration packs faces z and z + 2 of dest, with z = 0 then 1:
+    //   start:     face at z, then ch0 Z = z + 1
+    //   loop op 0: ch0 Z = z + 2
+    //   loop op 1: face at z + 2, closing the tile in the last outer iteration
+    //   end:       ch0 Z = 1 for the second outer iteration
+    ckernel::ckernel_template tmp(2, 1, TT_OP_INCADCZW(p_setadc::PAC, 0, 0, 0, 1), lltt::replay_insn(0, face_len));
+    tmp.set_start_op(lltt::replay_insn(0, face_len));
+    tmp.set_last_inner_loop_instr(lltt::replay_insn(0, face_len));
+    tmp.set_last_outer_loop_instr(lltt::replay_insn(face_len, face_len));
+    tmp.set_end_op(TT_OP_SETADCZW(p_setadc::PAC, 0, 0, 0, 1, 0b0001)); // ch0_z = 1
+    tmp.program();
+}
+
+inline void _llk_pack_transpose_faces_uninit_(
+    const std::uint32_t pack_dst_format, const std::uint32_t face_r_dim = FACE_R_DIM, const std::uint32_t num_faces = 4)
+{
+    // restore the address mods and mop of a plain pack
+    _llk_pack_init_<false, false, false>(pack_dst_format, face_r_dim, TILE_C_DIM, num_faces);
+}
+
 #include "llk_pack_untilize.h"
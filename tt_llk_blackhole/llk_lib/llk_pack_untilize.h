@@ -6,6 +6,7 @@
 
 #include <cstdint>
 
+#include "../../common/tensor_shape.h"
 #include "ckernel.h"
 #include "ckernel_globals.h"
 #include "ckernel_ops.h"
@@ -32,7 +33,10 @@ dense is used with num_faces == 2 and even block_ct_dim, where two 16x32 (or sma
 */
 template <std::uint32_t block_ct_dim, bool narrow_row = false, bool dense = false>
 inline void _llk_pack_untilize_mop_config_(
-    const std::uint32_t face_r_dim = FACE_R_DIM, const std::uint32_t num_faces = 4, const std::uint32_t tile_dst_offset = 0)
+    const std::uint32_t face_r_dim      = FACE_R_DIM,
+    const std::uint32_t num_faces       = 4,
+    const std::uint32_t tile_dst_offset = 0,
+    const std::uint32_t block_tiles     = block_ct_dim)
 {
     static_assert(!dense || (block_ct_dim % 2 == 0), "block_ct_dim must be even when dense");
     static_assert(!dense || (!narrow_row), "narrow_row must be false when dense");
@@ -43,9 +47,10 @@ inline void _llk_pack_untilize_mop_config_(
     over each tile in the block.
     When dense, we use all 4 interfaces to pack out a row each from 4 faces (2 tiles) that end up contiguous in L1
     because offsets align well and it improves perf, thus we halve the number of mop inner loops.
+    block_tiles is smaller than block_ct_dim only for the last block of a streamed row.
     */
-    constexpr std::uint32_t MOP_INNER_LOOP = dense ? block_ct_dim / 2 : block_ct_dim;
-    const std::uint32_t MOP_OUTER_LOOP     = face_r_dim;
+    const std::uint32_t MOP_INNER_LOOP = dense ? block_tiles / 2 : block_tiles;
+    const std::uint32_t MOP_OUTER_LOOP = face_r_dim;
 
     // For narrow row, the faces are stored in the first column of the tile, therefore requiring only one packer interface.
     const std::uint32_t PACK_INTF_SEL = (dense)                          ? p_pacr::ALL_INTF_ACTIVE
@@ -133,6 +138,7 @@ inline void _llk_pack_untilize_mop_config_(
 }
 
 static std::uint32_t tile_dst_offset_state = 0;
+static std::uint32_t block_tiles_state     = 0;
 
 template <
     std::uint32_t block_ct_dim,
@@ -160,6 +166,7 @@ inline void _llk_pack_untilize_init_(
 
     _llk_pack_untilize_mop_config_<block_ct_dim, narrow_row, dense>(face_r_dim, num_faces, 0);
     tile_dst_offset_state = 0;
+    block_tiles_state     = block_ct_dim;
 
     // Set CH0 Zstride = 2x16x16 faces, .z_src = {.incr = 1} jumps 2 faces
     std::uint32_t x_stride       = (pack_src_format & 0x3) == to_underlying(DataFormat::Float32)   ? 4
@@ -205,13 +212,16 @@ inline void _llk_pack_untilize_(
     [[maybe_unused]] const std::uint32_t pack_dst_format,
     const std::uint32_t face_r_dim         = FACE_R_DIM,
     const std::uint32_t num_faces          = 4,
-    const std::uint32_t tile_dst_rt_offset = 0)
+    const std::uint32_t tile_dst_rt_offset = 0,
+    const std::uint32_t block_tiles        = block_ct_dim)
 {
     static_assert(block_ct_dim <= (dense ? 16 : 8), "block_ct_dim must be <= 8 when not dense, <= 16 when dense");
     static_assert(!dense || (block_ct_dim % 2 == 0), "block_ct_dim must be even when dense");
     static_assert(!dense || (!narrow_row), "narrow_row must be false when dense");
     LLK_ASSERT(num_faces == 1 || num_faces == 2 || num_faces == 4, "num_faces must be 1, 2, or 4");
     LLK_ASSERT(!dense || (num_faces == 2), "num_faces must be 2 when dense");
+    LLK_ASSERT(block_tiles > 0 && block_tiles <= block_ct_dim, "block_tiles must be between 1 and block_ct_dim");
+    LLK_ASSERT(!dense || (block_tiles % 2 == 0), "block_tiles must be even when dense");
 
     /*
     full_ct_dim represents the number of input tiles.
@@ -227,11 +237,12 @@ inline void _llk_pack_untilize_(
 
     const std::uint32_t tile_dst_offset = tile_dst_ct_offset + tile_dst_rt_offset;
     // Needs to be revisited for perf impact with https://github.com/tenstorrent/tt-llk/issues/632
-    // If starting_tile_dst_offset is non-zero, reconfigure the template with the correct offset
-    if (tile_dst_offset != tile_dst_offset_state)
+    // If starting_tile_dst_offset is non-zero or the block is narrower, reconfigure the template to match
+    if (tile_dst_offset != tile_dst_offset_state || block_tiles != block_tiles_state)
     {
-        _llk_pack_untilize_mop_config_<block_ct_dim, narrow_row, dense>(face_r_dim, num_faces, tile_dst_offset);
+        _llk_pack_untilize_mop_config_<block_ct_dim, narrow_row, dense>(face_r_dim, num_faces, tile_dst_offset, block_tiles);
         tile_dst_offset_state = tile_dst_offset;
+        block_tiles_state     = block_tiles;
     }
 
     // Iterate over top, then over bottom faces in the block (if num_faces > 2)
@@ -247,6 +258,57 @@ inline void _llk_pack_untilize_(
     set_dst_write_addr(tile_dst_offset);            // reset w counter
 }
 
+/*
+Streaming untilize of a tile row of any width.
+full_ct_dim is a runtime value and does not have to be a multiple of block_ct_dim. The row is packed as
+ceil(full_ct_dim / block_ct_dim) blocks of at most block_ct_dim tiles, one dest section each, and every block writes its
+columns straight into the row-major output at a row stride of full_ct_dim tiles, so rows thousands of datums wide need
+neither several launches nor a gather on the host. The last block may be narrower; _llk_pack_untilize_ reprograms the
+MOP only when the block width changes, so a ragged row costs two reprograms per tile row.
+*/
+template <std::uint32_t block_ct_dim>
+inline void _llk_pack_untilize_stream_init_(
+    const std::uint32_t pack_src_format,
+    const std::uint32_t pack_dst_format,
+    const std::uint32_t full_ct_dim,
+    const std::uint32_t face_r_dim = FACE_R_DIM,
+    const std::uint32_t num_faces  = 4)
+{
+    static_assert(block_ct_dim > 0 && block_ct_dim <= MAX_TILES_IN_HALF_DEST, "block_ct_dim must be between 1 and MAX_TILES_IN_HALF_DEST");
+    LLK_ASSERT(full_ct_dim > 0, "full_ct_dim must be non-zero");
+
+    _llk_pack_untilize_init_<block_ct_dim>(pack_src_format, pack_dst_format, face_r_dim, num_faces);
+
+    // Replace the row stride of a single block with that of the whole row
+    const std::uint32_t output_addr_offset = SCALE_DATUM_SIZE(pack_dst_format, full_ct_dim * ((num_faces == 1) ? 1 : 2) * FACE_C_DIM);
+    TT_SETDMAREG(0, LOWER_HALFWORD(output_addr_offset / 16), 0, LO_16(p_gpr_pack::OUTPUT_ADDR_OFFSET));
+}
+
+/**
+ * @brief Packs block block_index of a tile row of full_ct_dim tiles into the row-major output at address.
+ *
+ * address is the 16B aligned start of the tile row in L1, the same for every block of the row. The tiles of the block
+ * are expected at dest tile tile_dst_rt_offset onwards. Requires _llk_pack_untilize_stream_init_ with the same full_ct_dim.
+ */
+template <std::uint32_t block_ct_dim>
+inline void _llk_pack_untilize_stream_(
+    const std::uint32_t address,
+    const std::uint32_t pack_dst_format,
+    const std::uint32_t full_ct_dim,
+    const std::uint32_t block_index,
+    const std::uint32_t face_r_dim         = FACE_R_DIM,
+    const std::uint32_t num_faces          = 4,
+    const std::uint32_t tile_dst_rt_offset = 0)
+{
+    LLK_ASSERT(block_index * block_ct_dim < full_ct_dim, "block_index is past the end of the row");
+
+    const std::uint32_t first_tile    = block_index * block_ct_dim;
+    const std::uint32_t block_tiles   = (full_ct_dim - first_tile < block_ct_dim) ? full_ct_dim - first_tile : block_ct_dim;
+    const std::uint32_t tile_row_size = SCALE_DATUM_SIZE(pack_dst_format, ((num_faces == 1) ? 1 : 2) * FACE_C_DIM);
+
+    _llk_pack_untilize_<block_ct_dim>(address + first_tile * tile_row_size / 16, pack_dst_format, face_r_dim, num_faces, tile_dst_rt_offset, block_tiles);
+}
+
 inline void _llk_pack_untilize_uninit_(const std::uint32_t pack_src_format)
 {
     TTI_STALLWAIT(p_stall::STALL_CFG, p_stall::PACK);
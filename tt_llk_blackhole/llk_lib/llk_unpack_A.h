@@ -300,3 +300,26 @@ inline void _llk_unpack_A_(const std::uint32_t address, const std::uint32_t unpa
     // Switch unpacker config context
     switch_config_context(unp_cfg_context);
 }
+
+/**
+ * @brief Unpacks one tile of a paged buffer, resolving its L1 address through a page table
+ *
+ * Same as _llk_unpack_A_, with the tile addressed by its logical index in the paged buffer.
+ * See _llk_unpack_get_paged_tile_address_ for the page table layout.
+ */
+template <
+    BroadcastType BType                          = BroadcastType::NONE,
+    bool acc_to_dest                             = false,
+    EltwiseBinaryReuseDestType binary_reuse_dest = EltwiseBinaryReuseDestType::NONE,
+    bool unpack_to_dest                          = false>
+inline void _llk_unpack_A_paged_(
+    const volatile std::uint32_t tt_l1_ptr *page_table,
+    const std::uint32_t log2_tiles_per_page,
+    const std::uint32_t tile_size,
+    const std::uint32_t tile_index,
+    const std::uint32_t unpack_src_format = 0,
+    const std::uint32_t unpack_dst_format = 0)
+{
+    const std::uint32_t address = _llk_unpack_get_paged_tile_address_(page_table, log2_tiles_per_page, tile_size, tile_index);
+    _llk_unpack_A_<BType, acc_to_dest, binary_reuse_dest, unpack_to_dest>(address, unpack_src_format, unpack_dst_format);
+}
@@ -11,11 +11,14 @@
 #include "ckernel_globals.h"
 #include "sfpi.h"
 #include "sfpu/ckernel_sfpu_abs.h"
+#include "sfpu/ckernel_sfpu_accuracy.h"
 #include "sfpu/ckernel_sfpu_activations.h"
 #include "sfpu/ckernel_sfpu_add_int.h"
+#include "sfpu/ckernel_sfpu_bfp_exponent.h"
 #include "sfpu/ckernel_sfpu_binary.h"
 #include "sfpu/ckernel_sfpu_binary_bitwise.h"
 #include "sfpu/ckernel_sfpu_cast_fp32_to_fp16a.h"
+#include "sfpu/ckernel_sfpu_chain.h"
 #include "sfpu/ckernel_sfpu_clamp.h"
 #include "sfpu/ckernel_sfpu_comp.h"
 #include "sfpu/ckernel_sfpu_converter.h"
@@ -31,29 +34,39 @@
 #include "sfpu/ckernel_sfpu_is_fp16_zero.h"
 #include "sfpu/ckernel_sfpu_isinf_isnan.h"
 #include "sfpu/ckernel_sfpu_load_config.h"
+#include "sfpu/ckernel_sfpu_loadmacro.h"
 #include "sfpu/ckernel_sfpu_log.h"
+#include "sfpu/ckernel_sfpu_lut.h"
 #include "sfpu/ckernel_sfpu_max_pool_indices.h"
+#include "sfpu/ckernel_sfpu_minimax.h"
 #include "sfpu/ckernel_sfpu_mul_int.h"
+#include "sfpu/ckernel_sfpu_mx.h"
 #include "sfpu/ckernel_sfpu_negative.h"
+#include "sfpu/ckernel_sfpu_optimizer.h"
 #include "sfpu/ckernel_sfpu_quant.h"
+#include "sfpu/ckernel_sfpu_random.h"
 #include "sfpu/ckernel_sfpu_recip.h"
 #include "sfpu/ckernel_sfpu_reduce.h"
 #include "sfpu/ckernel_sfpu_relu.h"
 #include "sfpu/ckernel_sfpu_reshuffle_rows.h"
+#include "sfpu/ckernel_sfpu_rope.h"
 #include "sfpu/ckernel_sfpu_rounding_ops.h"
 #include "sfpu/ckernel_sfpu_rsqrt.h"
 #include "sfpu/ckernel_sfpu_shift.h"
 #include "sfpu/ckernel_sfpu_sigmoid.h"
 #include "sfpu/ckernel_sfpu_sign.h"
 #include "sfpu/ckernel_sfpu_silu.h"
+#include "sfpu/ckernel_sfpu_softmax.h"
 #include "sfpu/ckernel_sfpu_sqrt.h"
 #include "sfpu/ckernel_sfpu_square.h"
 #include "sfpu/ckernel_sfpu_sub_int.h"
 #include "sfpu/ckernel_sfpu_tanh.h"
 #include "sfpu/ckernel_sfpu_tanh_derivative.h"
+#include "sfpu/ckernel_sfpu_ternary.h"
 #include "sfpu/ckernel_sfpu_threshold.h"
 #include "sfpu/ckernel_sfpu_topk.h"
 #include "sfpu/ckernel_sfpu_trigonometry.h"
 #include "sfpu/ckernel_sfpu_typecast.h"
+#include "sfpu/ckernel_sfpu_typecast_fp8.h"
 #include "sfpu/ckernel_sfpu_welfords.h"
 #include "sfpu/ckernel_sfpu_where.h"
@@ -0,0 +1,367 @@
+// SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <limits>
+
+#include "ckernel_sfpu_elu.h"
+#include "ckernel_sfpu_exp.h"
+#include "ckernel_sfpu_gelu.h"
+#include "ckernel_sfpu_minimax.h"
+#include "ckernel_sfpu_recip.h"
+#include "ckernel_sfpu_rsqrt.h"
+#include "ckernel_sfpu_sigmoid.h"
+#include "ckernel_sfpu_silu.h"
+#include "ckernel_sfpu_sqrt.h"
+#include "ckernel_sfpu_tanh.h"
+#include "llk_defs.h"
+#include "sfpi.h"
+
+namespace ckernel::sfpu
+{
+
+// ============================================================================
+// Accuracy-tiered unary SFPU ops
+// ============================================================================
+// One SfpuAccuracy template argument replaces the per-op APPROXIMATION_MODE / FAST_APPROX / is_fp32_dest_acc_en
+// combinations, so a model picks its accuracy/speed trade-off once and every op honours it:
+//
+//   _init_exponential_tiered_<ACCURACY>();
+//   _calculate_exponential_tiered_<ACCURACY, ITERATIONS>();
+//
+// Fp32 keeps exp within about 1 fp32 ulp; ops composed from it and the reciprocal (sigmoid, silu, tanh, elu) within a
+// few. Ops without an fp32-grade implementation (GELU) run their most accurate path for both Fp32 and Bf16. Measured
+// errors per op and tier are reported by tests/python_tests/test_sfpu_accuracy.py.
+//
+// Covered: exp, reciprocal, sqrt, rsqrt, sigmoid, silu, tanh, elu and gelu. The log family and the trigonometric ops
+// keep their own APPROXIMATION_MODE knobs until they have a range reduction the Fp32 tier can be held to.
+
+// Relative bound the minimax fits of each tier are held to. Bf16 keeps the fit well below half an ulp, so the result
+// rounds correctly in all but the closest ties.
+constexpr double sfpu_accuracy_fit_bound(const SfpuAccuracy accuracy)
+{
+    return accuracy == SfpuAccuracy::Fp32 ? fp32_ulps(1) : bf16_ulps(0.125);
+}
+
+// Newton-Raphson steps of _sfpu_reciprocal_ per tier
+constexpr int sfpu_accuracy_reciprocal_iterations(const SfpuAccuracy accuracy)
+{
+    return accuracy == SfpuAccuracy::Fp32 ? 2 : (accuracy == SfpuAccuracy::Bf16 ? 1 : 0);
+}
+
+// exp is range reduced to |r| <= ln2 / 2 before the polynomial
+constexpr double EXP_REDUCED_RANGE = 0.34657359027997264;
+
+// (exp(x) - 1) / x, so that expm1 keeps full relative accuracy for small x
+struct MinimaxExpm1OverX
+{
+    static constexpr bool RELATIVE = true;
+
+    static constexpr double eval(const double x)
+    {
+        return internal::cx_abs(x) < 1e-9 ? 1.0 + 0.5 * x : (internal::cx_exp(x) - 1.0) / x;
+    }
+};
+
+template <SfpuAccuracy ACCURACY>
+struct SfpuAccuracyFits
+{
+    static constexpr int EXP_DEGREE = minimax_degree<MinimaxExp>(-EXP_REDUCED_RANGE, EXP_REDUCED_RANGE, sfpu_accuracy_fit_bound(ACCURACY));
+    static_assert(EXP_DEGREE <= 8, "No exp polynomial of degree <= 8 meets the tier bound");
+    static constexpr MinimaxFit<EXP_DEGREE> EXP = minimax_fit<MinimaxExp, EXP_DEGREE>(-EXP_REDUCED_RANGE, EXP_REDUCED_RANGE);
+
+    // Covers [-ln2, 0], past which exp(x) - 1 loses no more than the rounding of exp(x)
+    static constexpr int EXPM1_DEGREE = minimax_degree<MinimaxExpm1OverX>(-2.0 * EXP_REDUCED_RANGE, 0.0, sfpu_accuracy_fit_bound(ACCURACY));
+    static_assert(EXPM1_DEGREE <= 8, "No expm1 polynomial of degree <= 8 meets the tier bound");
+    static constexpr MinimaxFit<EXPM1_DEGREE> EXPM1 = minimax_fit<MinimaxExpm1OverX, EXPM1_DEGREE>(-2.0 * EXP_REDUCED_RANGE, 0.0);
+};
+
+/**
+ * @brief exp(x) for the Fp32 and Bf16 tiers.
+ *
+ * x = k * ln2 + r with k rounded to nearest, so |r| <= ln2 / 2; exp(r) comes from the tier's minimax fit and 2^k is
+ * applied to the exponent field directly. ln2 is split so that k * LN2_HI is exact for |k| <= 128. Saturates to inf
+ * above the largest finite result and flushes to zero below the smallest normal one.
+ */
+template <SfpuAccuracy ACCURACY>
+sfpi_inline sfpi::vFloat _sfpu_exp_tiered_(const sfpi::vFloat x)
+{
+    static_assert(ACCURACY != SfpuAccuracy::FastApprox, "FastApprox exp goes through _calculate_exponential_body_");
+
+    constexpr float LN2_RECIP = 1.4426950408889634f;
+    constexpr float LN2_HI    = 0.693145751953125f;
+    constexpr float LN2_LO    = 1.428606765330187e-6f;
+
+    sfpi::vInt k    = sfpi::float_to_int16(x * LN2_RECIP, 0);
+    sfpi::vFloat kf = sfpi::int32_to_float(k, 0);
+    sfpi::vFloat r  = x - kf * LN2_HI;
+    r               = r - kf * LN2_LO;
+
+    // exp(r) is in [0.70, 1.42], so adding k to its exponent cannot wrap inside the clamped range
+    sfpi::vFloat result = minimax_eval(r, SfpuAccuracyFits<ACCURACY>::EXP);
+    result              = sfpi::setexp(result, sfpi::exexp(result) + k + 127);
+
+    v_if (x > 88.72283f)
+    {
+        result = std::numeric_limits<float>::infinity();
+    }
+    v_elseif (x < -87.33654f)
+    {
+        result = 0.0f;
+    }
+    v_endif;
+
+    return result;
+}
+
+// exp(x) - 1 for x <= 0; the expm1 polynomial avoids the cancellation near zero, past -ln2 exp(x) - 1 loses nothing
+template <SfpuAccuracy ACCURACY>
+sfpi_inline sfpi::vFloat _sfpu_expm1_negative_tiered_(const sfpi::vFloat x)
+{
+    sfpi::vFloat m;
+    v_if (x > static_cast<float>(-2.0 * EXP_REDUCED_RANGE))
+    {
+        m = x * minimax_eval(x, SfpuAccuracyFits<ACCURACY>::EXPM1);
+    }
+    v_else
+    {
+        m = _sfpu_exp_tiered_<ACCURACY>(x) - sfpi::vConst1;
+    }
+    v_endif;
+
+    return m;
+}
+
+// tanh(|x|) = -m / (m + 2) with m = expm1(-2|x|) in (-1, 0]
+template <SfpuAccuracy ACCURACY>
+sfpi_inline sfpi::vFloat _sfpu_tanh_tiered_(const sfpi::vFloat x)
+{
+    sfpi::vFloat u = sfpi::setsgn(x, 1);
+    u              = u + u;
+
+    sfpi::vFloat m = _sfpu_expm1_negative_tiered_<ACCURACY>(u);
+
+    sfpi::vFloat result = -m * _sfpu_reciprocal_<sfpu_accuracy_reciprocal_iterations(ACCURACY)>(m + 2.0f);
+    return sfpi::setsgn(result, x);
+}
+
+// exp
+
+template <SfpuAccuracy ACCURACY, int ITERATIONS>
+inline void _calculate_exponential_tiered_()
+{
+    if constexpr (ACCURACY == SfpuAccuracy::FastApprox)
+    {
+        _calculate_exponential_<true, false, ITERATIONS, false, false>(p_sfpu::kCONST_1_FP16B);
+    }
+    else
+    {
+#pragma GCC unroll 0
+        for (int d = 0; d < ITERATIONS; d++)
+        {
+            sfpi::dst_reg[0] = _sfpu_exp_tiered_<ACCURACY>(sfpi::dst_reg[0]);
+            sfpi::dst_reg++;
+        }
+    }
+}
+
+template <SfpuAccuracy ACCURACY>
+inline void _init_exponential_tiered_()
+{
+    if constexpr (ACCURACY == SfpuAccuracy::FastApprox)
+    {
+        _init_exponential_<true, false, 0x3F800000>();
+    }
+}
+
+// reciprocal
+
+template <SfpuAccuracy ACCURACY, int ITERATIONS>
+inline void _calculate_reciprocal_tiered_()
+{
+    _calculate_reciprocal_<is_sfpu_approx(ACCURACY), ITERATIONS, ACCURACY == SfpuAccuracy::Fp32>(ITERATIONS);
+}
+
+template <SfpuAccuracy ACCURACY>
+inline void _init_reciprocal_tiered_()
+{
+    _init_reciprocal_<is_sfpu_approx(ACCURACY), ACCURACY == SfpuAccuracy::Fp32>();
+}
+
+// sqrt, rsqrt
+
+template <SfpuAccuracy ACCURACY, int ITERATIONS>
+inline void _calculate_sqrt_tiered_()
+{
+    _calculate_sqrt_<is_sfpu_approx(ACCURACY), ITERATIONS, ACCURACY == SfpuAccuracy::Fp32, is_sfpu_approx(ACCURACY)>(ITERATIONS);
+}
+
+template <SfpuAccuracy ACCURACY>
+inline void _init_sqrt_tiered_()
+{
+    _init_sqrt_<is_sfpu_approx(ACCURACY)>();
+}
+
+template <SfpuAccuracy ACCURACY, int ITERATIONS>
+inline void _calculate_rsqrt_tiered_()
+{
+    _calculate_rsqrt_<is_sfpu_approx(ACCURACY), ITERATIONS, ACCURACY == SfpuAccuracy::Fp32, is_sfpu_approx(ACCURACY)>(ITERATIONS);
+}
+
+template <SfpuAccuracy ACCURACY>
+inline void _init_rsqrt_tiered_()
+{
+    _init_rsqrt_<is_sfpu_approx(ACCURACY)>();
+}
+
+// sigmoid: 6-entry LUT for FastApprox, 1 / (1 + exp(-x)) otherwise
+
+template <SfpuAccuracy ACCURACY, int ITERATIONS>
+inline void _calculate_sigmoid_tiered_()
+{
+    if constexpr (ACCURACY == SfpuAccuracy::FastApprox)
+    {
+        _calculate_sigmoid_<true, ITERATIONS>(ITERATIONS);
+    }
+    else
+    {
+#pragma GCC unroll 0
+        for (int d = 0; d < ITERATIONS; d++)
+        {
+            sfpi::vFloat in      = sfpi::dst_reg[0];
+            sfpi::vFloat exp_neg = _sfpu_exp_tiered_<ACCURACY>(-in);
+            sfpi::dst_reg[0]     = _sfpu_reciprocal_<sfpu_accuracy_reciprocal_iterations(ACCURACY)>(exp_neg + sfpi::vConst1);
+            sfpi::dst_reg++;
+        }
+    }
+}
+
+template <SfpuAccuracy ACCURACY>
+inline void _init_sigmoid_tiered_()
+{
+    if constexpr (ACCURACY == SfpuAccuracy::FastApprox)
+    {
+        _init_sigmoid_<true>();
+    }
+    else
+    {
+        _init_sfpu_reciprocal_<false>();
+    }
+}
+
+// silu: piecewise sigmoid for FastApprox, x / (1 + exp(-x)) otherwise
+
+template <SfpuAccuracy ACCURACY, int ITERATIONS>
+inline void _calculate_silu_tiered_()
+{
+    if constexpr (ACCURACY == SfpuAccuracy::FastApprox)
+    {
+        _calculate_silu_<true, ITERATIONS>();
+    }
+    else
+    {
+#pragma GCC unroll 0
+        for (int d = 0; d < ITERATIONS; d++)
+        {
+            sfpi::vFloat in      = sfpi::dst_reg[0];
+            sfpi::vFloat exp_neg = _sfpu_exp_tiered_<ACCURACY>(-in);
+            sfpi::dst_reg[0]     = in * _sfpu_reciprocal_<sfpu_accuracy_reciprocal_iterations(ACCURACY)>(exp_neg + sfpi::vConst1);
+            sfpi::dst_reg++;
+        }
+    }
+}
+
+template <SfpuAccuracy ACCURACY>
+inline void _init_silu_tiered_()
+{
+    if constexpr (ACCURACY != SfpuAccuracy::FastApprox)
+    {
+        _init_sfpu_reciprocal_<false>();
+    }
+}
+
+// tanh: 3-entry LUT for FastApprox, expm1-based otherwise
+
+template <SfpuAccuracy ACCURACY, int ITERATIONS>
+inline void _calculate_tanh_tiered_()
+{
+    if constexpr (ACCURACY == SfpuAccuracy::FastApprox)
+    {
+        _calculate_tanh_<true, ITERATIONS>(ITERATIONS);
+    }
+    else
+    {
+#pragma GCC unroll 0
+        for (int d = 0; d < ITERATIONS; d++)
+        {
+            sfpi::dst_reg[0] = _sfpu_tanh_tiered_<ACCURACY>(sfpi::dst_reg[0]);
+            sfpi::dst_reg++;
+        }
+    }
+}
+
+template <SfpuAccuracy ACCURACY>
+inline void _init_tanh_tiered_()
+{
+    if constexpr (ACCURACY == SfpuAccuracy::FastApprox)
+    {
+        _init_tanh_<true>();
+    }
+    else
+    {
+        _init_sfpu_reciprocal_<false>();
+    }
+}
+
+// elu with alpha = 1: approximate exp for FastApprox, expm1-based otherwise
+
+template <SfpuAccuracy ACCURACY, int ITERATIONS>
+inline void _calculate_elu_tiered_()
+{
+    if constexpr (ACCURACY == SfpuAccuracy::FastApprox)
+    {
+        _calculate_elu_<true, ITERATIONS>(0x3F800000 /* alpha = 1.0f */);
+    }
+    else
+    {
+#pragma GCC unroll 0
+        for (int d = 0; d < ITERATIONS; d++)
+        {
+            sfpi::vFloat v = sfpi::dst_reg[0];
+            v_if (v < 0.0f)
+            {
+                v = _sfpu_expm1_negative_tiered_<ACCURACY>(v);
+            }
+            v_endif;
+            sfpi::dst_reg[0] = v;
+            sfpi::dst_reg++;
+        }
+    }
+}
+
+template <SfpuAccuracy ACCURACY>
+inline void _init_elu_tiered_()
+{
+    if constexpr (ACCURACY == SfpuAccuracy::FastApprox)
+    {
+        _init_elu_<true>();
+    }
+}
+
+// gelu: LUT for FastApprox, CDF polynomial otherwise
+
+template <SfpuAccuracy ACCURACY, int ITERATIONS>
+inline void _calculate_gelu_tiered_()
+{
+    _calculate_gelu_<is_sfpu_approx(ACCURACY), ITERATIONS>();
+}
+
+template <SfpuAccuracy ACCURACY>
+inline void _init_gelu_tiered_()
+{
+    _init_gelu_<is_sfpu_approx(ACCURACY)>();
+}
+
+} // namespace ckernel::sfpu
@@ -7,9 +7,14 @@
 #include <cstdint>
 #include <limits>
 
+#include "ckernel_addrmod.h"
+#include "ckernel_instr_params.h"
+#include "ckernel_sfpu_converter.h"
 #include "ckernel_sfpu_exp.h"
 #include "ckernel_sfpu_log.h"
 #include "ckernel_sfpu_recip.h"
+#include "ckernel_sfpu_row_reduce.h"
+#include "llk_defs.h"
 #include "sfpi.h"
 
 namespace ckernel
@@ -168,5 +173,195 @@ inline void _sfpu_binary_init_()
     }
 }
 
+// ============================================================================
+// Broadcast second operand
+// ============================================================================
+// Variants of _calculate_sfpu_binary_ whose second operand is a runtime scalar, a single row (broadcast down the
+// columns) or a single column (broadcast across the rows). One operand tile serves any number of input tiles, so no
+// broadcast tile has to be materialised per input tile. DIV and XLOGY transform the operand once, to 1 / b and log(b),
+// which leaves a single multiply per element.
+
+// Operand transform applied once per broadcast value
+template <BinaryOp BINOP>
+sfpi_inline sfpi::vFloat _sfpu_binary_bcast_operand_(sfpi::vFloat in1)
+{
+    if constexpr (BINOP == BinaryOp::DIV)
+    {
+        in1 = _sfpu_reciprocal_<2>(in1);
+    }
+    else if constexpr (BINOP == BinaryOp::XLOGY)
+    {
+        sfpi::vFloat log_in1 = _calculate_log_body_no_init_(in1);
+        v_if ((in1 < 0.0f) || (in1 == std::numeric_limits<float>::quiet_NaN()))
+        {
+            log_in1 = std::numeric_limits<float>::quiet_NaN();
+        }
+        v_endif;
+        in1 = log_in1;
+    }
+    return in1;
+}
+
+template <BinaryOp BINOP>
+sfpi_inline sfpi::vFloat _sfpu_binary_bcast_apply_(const sfpi::vFloat in0, const sfpi::vFloat in1)
+{
+    static_assert(
+        BINOP == BinaryOp::ADD || BINOP == BinaryOp::SUB || BINOP == BinaryOp::MUL || BINOP == BinaryOp::DIV || BINOP == BinaryOp::RSUB ||
+            BINOP == BinaryOp::POW || BINOP == BinaryOp::XLOGY,
+        "Broadcast binary SFPU ops cover the float ops ADD to XLOGY");
+
+    if constexpr (BINOP == BinaryOp::ADD)
+    {
+        return in0 + in1;
+    }
+    else if constexpr (BINOP == BinaryOp::SUB)
+    {
+        return in0 - in1;
+    }
+    else if constexpr (BINOP == BinaryOp::RSUB)
+    {
+        return in1 - in0;
+    }
+    else if constexpr (BINOP == BinaryOp::POW)
+    {
+        return _calculate_sfpu_binary_power_(in0, in1);
+    }
+    else
+    {
+        // MUL, and DIV / XLOGY on the transformed operand
+        return in0 * in1;
+    }
+}
+
+/**
+ * @brief x BINOP scalar in place, as a unary op: run through _llk_math_eltwise_unary_sfpu_params_.
+ *
+ * @param scalar fp32 bits of the second operand, transformed once per face and held in an LREG
+ */
+template <bool APPROXIMATION_MODE, BinaryOp BINOP, int ITERATIONS = 8>
+inline void _calculate_sfpu_binary_scalar_(const std::uint32_t scalar)
+{
+    const sfpi::vFloat in1 = _sfpu_binary_bcast_operand_<BINOP>(Converter::as_float(scalar));
+
+    for (int d = 0; d < ITERATIONS; d++)
+    {
+        sfpi::dst_reg[0] = _sfpu_binary_bcast_apply_<BINOP>(sfpi::dst_reg[0], in1);
+        sfpi::dst_reg++;
+    }
+}
+
+/**
+ * @brief Spreads the broadcast values of operand tile dst_index_in1 over the lanes that load them, then applies the
+ * operand transform of BINOP.
+ *
+ * ROW takes tile row 0. SFPLOAD puts a row in one of the four rows of an LREG, so row 0 is copied to all four LREGs and
+ * transposed across them; rows 0-3 of faces 0 and 1 then all hold row 0.
+ * COL takes tile column 0. Each row's even-column left-face load has column 0 in lane 0; the other lanes are zeroed
+ * and a rotate-add all-reduce copies lane 0 to them, so columns 0, 2, ..., 14 of faces 0 and 2 all hold column 0.
+ *
+ * Clobbers the rest of the operand tile and is not idempotent for DIV and XLOGY: run it once per operand tile, before
+ * any number of _calculate_sfpu_binary_bcast_ calls. Run with VectorMode::None.
+ */
+template <bool APPROXIMATION_MODE, BinaryOp BINOP, BroadcastType BCAST>
+inline void _calculate_sfpu_binary_bcast_prepare_(const std::uint32_t dst_index_in1)
+{
+    static_assert(BCAST == BroadcastType::ROW || BCAST == BroadcastType::COL, "Scalar operands go through _calculate_sfpu_binary_scalar_");
+
+    constexpr std::uint32_t dst_tile_size_sfpi = 32;
+    constexpr std::uint32_t dst_tile_size_raw  = 64;
+
+    const std::uint32_t in1_base     = dst_index_in1 * dst_tile_size_sfpi;
+    const std::uint32_t in1_base_raw = dst_index_in1 * dst_tile_size_raw;
+
+    if constexpr (BCAST == BroadcastType::ROW)
+    {
+        // Even and odd columns of faces 0 and 1, in sfpi rows
+        constexpr std::uint32_t ROW_OFFSETS[4] = {0, 1, 8, 9};
+
+#pragma GCC unroll 0
+        for (std::uint32_t i = 0; i < 4; i++)
+        {
+            const std::uint32_t addr = in1_base_raw + 2 * ROW_OFFSETS[i];
+            TT_SFPLOAD(p_sfpu::LREG0, InstrModLoadStore::DEFAULT, ADDR_MOD_3, addr);
+            TTI_SFPMOV(0, p_sfpu::LREG0, p_sfpu::LREG1, 0);
+            TTI_SFPMOV(0, p_sfpu::LREG0, p_sfpu::LREG2, 0);
+            TTI_SFPMOV(0, p_sfpu::LREG0, p_sfpu::LREG3, 0);
+            TTI_SFPTRANSP(0, 0, 0, 0);
+            TT_SFPSTORE(p_sfpu::LREG0, InstrModLoadStore::DEFAULT, ADDR_MOD_3, addr);
+        }
+
+        for (std::uint32_t i = 0; i < 4; i++)
+        {
+            sfpi::dst_reg[in1_base + ROW_OFFSETS[i]] = _sfpu_binary_bcast_operand_<BINOP>(sfpi::dst_reg[in1_base + ROW_OFFSETS[i]]);
+        }
+    }
+    else
+    {
+#pragma GCC unroll 0
+        for (std::uint32_t g = 0; g < 8; g++)
+        {
+            const std::uint32_t e = in1_base + SFPU_ROW_GROUP_OFFSETS[g];
+            sfpi::vFloat column   = sfpi::dst_reg[e];
+            // The tile id constant holds 2 * lane, so this keeps lane 0 of each row
+            v_if ((sfpi::vConstTileId & 0xE) != 0)
+            {
+                column = 0.0f;
+            }
+            v_endif;
+            sfpi::dst_reg[e] = column;
+        }
+
+        // Groups are paired 4 raw rows apart: (0, 2), (4, 6), (16, 18), (20, 22) in sfpi rows
+#pragma GCC unroll 0
+        for (std::uint32_t g = 0; g < 8; g += 2)
+        {
+            const std::uint32_t addr = in1_base_raw + 2 * SFPU_ROW_GROUP_OFFSETS[g];
+            _sfpu_row_allreduce_x2_<false>(addr, addr);
+        }
+
+#pragma GCC unroll 0
+        for (std::uint32_t g = 0; g < 8; g++)
+        {
+            const std::uint32_t e = in1_base + SFPU_ROW_GROUP_OFFSETS[g];
+            sfpi::dst_reg[e]      = _sfpu_binary_bcast_operand_<BINOP>(sfpi::dst_reg[e]);
+        }
+    }
+}
+
+/**
+ * @brief in0 BINOP broadcast(in1) over a whole tile, with in1 prepared by _calculate_sfpu_binary_bcast_prepare_.
+ *
+ * Each element load of in0 pairs with the load of in1 that holds its broadcast value: for ROW the same column half of
+ * row group 0 in face 0 or 1, for COL the even-column left-face load of the same row group. dst_index_out may alias
+ * dst_index_in0. Requires _sfpu_binary_init_. Run with VectorMode::None.
+ */
+template <bool APPROXIMATION_MODE, BinaryOp BINOP, BroadcastType BCAST>
+inline void _calculate_sfpu_binary_bcast_(const std::uint32_t dst_index_in0, const std::uint32_t dst_index_in1, const std::uint32_t dst_index_out)
+{
+    static_assert(BCAST == BroadcastType::ROW || BCAST == BroadcastType::COL, "Scalar operands go through _calculate_sfpu_binary_scalar_");
+
+    constexpr std::uint32_t dst_tile_size_sfpi = 32;
+
+    const std::uint32_t in0_base = dst_index_in0 * dst_tile_size_sfpi;
+    const std::uint32_t in1_base = dst_index_in1 * dst_tile_size_sfpi;
+    const std::uint32_t out_base = dst_index_out * dst_tile_size_sfpi;
+
+#pragma GCC unroll 0
+    for (std::uint32_t face = 0; face < 4; face++)
+    {
+        // ROW: row group 0 of the face in the same column of faces; COL: the left face of the same row of faces
+        const std::uint32_t in1_face = in1_base + ((BCAST == BroadcastType::ROW) ? (face & 1) * 8 : (face >> 1) * 16);
+
+#pragma GCC unroll 8
+        for (std::uint32_t d = 0; d < 8; d++)
+        {
+            const std::uint32_t e       = face * 8 + d;
+            sfpi::vFloat in1            = sfpi::dst_reg[in1_face + ((BCAST == BroadcastType::ROW) ? (d & 1) : (d & 6))];
+            sfpi::vFloat in0            = sfpi::dst_reg[in0_base + e];
+            sfpi::dst_reg[out_base + e] = _sfpu_binary_bcast_apply_<BINOP>(in0, in1);
+        }
+    }
+}
+
 } // namespace sfpu
 } // namespace ckernel
@@ -0,0 +1,128 @@
+// SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "ckernel_addrmod.h"
+#include "ckernel_ops.h"
+
+namespace ckernel::sfpu
+{
+
+// ============================================================================
+// SFPLOADMACRO description layer
+// ============================================================================
+// An SFPLOADMACRO loads a dest row group into LREG[lreg_ind & 3] and schedules up to four more instructions on the
+// simple, MAD, round and store units, each after a fixed delay. Issuing one per row group with the load register
+// rotating through LREG0-3 keeps up to four row groups in flight, so the op retires one row group per issue slot.
+//
+// A schedule is described by:
+//   - up to four programmable macro instructions (mux entries 4-7), given as instruction words: TT_OP_SFPMAD(...)
+//   - up to four sequences, each picking one mux entry and a delay per unit: loadmacro_sequence(loadmacro_slot(...))
+// Mux entries 0-3 are fixed: 0 = no instruction, 2 = NOP, 3 = SFPSTORE.
+
+constexpr std::uint32_t LOADMACRO_NONE  = 0;
+constexpr std::uint32_t LOADMACRO_NOP   = 2;
+constexpr std::uint32_t LOADMACRO_STORE = 3;
+
+// Mux entry of programmable macro instruction 0-3
+constexpr std::uint32_t loadmacro_instr(const std::uint32_t index)
+{
+    return 4 + index;
+}
+
+/**
+ * @brief Encodes one unit slot of a LOADMACRO sequence.
+ *
+ * @param mux_entry Macro instruction to run: LOADMACRO_NONE/NOP/STORE or loadmacro_instr(i)
+ * @param delay Cycles after the load at which the instruction issues, 0-7
+ * @param srcb_from_load Feed the loaded value into the instruction's VB operand
+ * @param staging Write the result to the staging register instead of LREG[lreg_ind]; for the store unit, store from it
+ */
+constexpr std::uint32_t loadmacro_slot(const std::uint32_t mux_entry, const std::uint32_t delay, const bool srcb_from_load = false, const bool staging = false)
+{
+    return (static_cast<std::uint32_t>(srcb_from_load) << 7) | (static_cast<std::uint32_t>(staging) << 6) | ((delay & 0x7) << 3) | (mux_entry & 0x7);
+}
+
+constexpr std::uint32_t loadmacro_sequence(const std::uint32_t simple, const std::uint32_t mad, const std::uint32_t round, const std::uint32_t store)
+{
+    return simple | (mad << 8) | (round << 16) | (store << 24);
+}
+
+// Fast-approx exp sequence 0: SHIFT from staging, MAD on the loaded value, ROUND, STORE from staging
+static_assert(
+    loadmacro_sequence(
+        loadmacro_slot(loadmacro_instr(3), 3, true, true),
+        loadmacro_slot(loadmacro_instr(1), 0, true),
+        loadmacro_slot(loadmacro_instr(2), 2),
+        loadmacro_slot(LOADMACRO_STORE, 4, false, true)) == 0x631685DF,
+    "LOADMACRO sequence encoding mismatch");
+
+/**
+ * @brief Installs INSTR_WORD as programmable macro instruction INDEX (mux entry 4 + INDEX).
+ *
+ * Goes through SFPCONFIG rather than the backdoor load, so any operand encoding is accepted, including a constant
+ * register as the destination of a SWAP.
+ */
+template <std::uint32_t INDEX, std::uint32_t INSTR_WORD>
+inline void _sfpu_loadmacro_program_instruction_()
+{
+    static_assert(INDEX < 4, "Only four programmable macro instructions are available");
+
+    TTI_SFPLOADI(0, 0xA, INSTR_WORD & 0xFFFF);
+    TTI_SFPLOADI(0, 0x8, INSTR_WORD >> 16);
+    TTI_SFPCONFIG(0, INDEX, 0);
+    TTI_SFPNOP;
+}
+
+template <std::uint32_t SEQUENCE, std::uint32_t SEQUENCE_WORD>
+inline void _sfpu_loadmacro_program_sequence_()
+{
+    static_assert(SEQUENCE < 4, "Only four macro sequence registers are available");
+
+    TTI_SFPLOADI(0, 0xA, SEQUENCE_WORD & 0xFFFF);
+    TTI_SFPLOADI(0, 0x8, SEQUENCE_WORD >> 16);
+    TTI_SFPCONFIG(0, 4 + SEQUENCE, 0);
+}
+
+template <std::uint32_t SEQUENCE, std::uint32_t ISSUE_NOPS, std::size_t... GROUP>
+inline void _sfpu_loadmacro_issue_(std::index_sequence<GROUP...>)
+{
+    constexpr std::size_t LAST = sizeof...(GROUP) - 1;
+
+    (
+        []
+        {
+            TTI_SFPLOADMACRO((SEQUENCE << 2) | (GROUP & 0x3), 0, ADDR_MOD_3, GROUP * 2);
+            if constexpr (GROUP != LAST)
+            {
+                for (std::uint32_t i = 0; i < ISSUE_NOPS; i++)
+                {
+                    TTI_SFPNOP;
+                }
+            }
+        }(),
+        ...);
+}
+
+/**
+ * @brief Runs sequence SEQUENCE over ITERATIONS row groups starting at the current dest address.
+ *
+ * Row group d is loaded from dest offset 2 * d (even/odd column halves alternate) into LREG[d % 4]. ISSUE_NOPS pads
+ * between issues, for sequences whose simple unit instruction is not pipelined (SFPSWAP needs 1). The caller drains
+ * the pipeline before reusing the LREGs or reprogramming the sequence.
+ */
+template <std::uint32_t SEQUENCE, int ITERATIONS, std::uint32_t ISSUE_NOPS = 0>
+inline void _sfpu_loadmacro_run_()
+{
+    static_assert(SEQUENCE < 4, "Only four macro sequence registers are available");
+
+    _sfpu_loadmacro_issue_<SEQUENCE, ISSUE_NOPS>(std::make_index_sequence<ITERATIONS> {});
+}
+
+} // namespace ckernel::sfpu
@@ -0,0 +1,136 @@
+// SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+
+#include "ckernel_defs.h"
+#include "ckernel_instr_params.h"
+#include "ckernel_ops.h"
+#include "ckernel_sfpu_load_config.h"
+#include "sfpi.h"
+
+namespace ckernel::sfpu
+{
+
+// ============================================================================
+// Piecewise lookup-table activations
+// ============================================================================
+// Evaluates an arbitrary activation from a host-generated table with one SFPLUTFP32 per row group, the same
+// instruction behind the sigmoid and GELU LUT paths. The input is first mapped onto the table axis,
+//   t = x * scale + offset
+// and |t| picks one of six segments, whose breakpoints are fixed by the table mode:
+//   LUT_MODE 0: 0.5, 1, 1.5, 2, 4    (SFPLUTFP32_MOD0_FP16_6ENTRY_TABLE1)
+//   LUT_MODE 1: 0.5, 1, 1.5, 2, 3    (SFPLUTFP32_MOD0_FP16_6ENTRY_TABLE2)
+// Segment i evaluates, with u = |t|,
+//   linear:    A_i * u + B_i
+//   quadratic: u * (A_i * u + B_i) + C
+// The six (A, B) pairs fill LREG0-2 and LREG4-6, so a quadratic gets a single constant term C shared by all segments.
+// LutSymmetry extends the result to negative t: Clamp clamps t to 0, Even mirrors it and Odd mirrors and negates it.
+//
+// Tables are built on the host by tests/python_tests/helpers/sfpu_lut.py, which fits each segment by least squares
+// and packs the result in SfpuLutTable order.
+
+struct SfpuLutTable
+{
+    std::uint32_t slopes[3];     // A0-A5 as fp16 pairs, the even entry in the low half
+    std::uint32_t intercepts[3]; // B0-B5, packed as the slopes
+    std::uint32_t scale;         // fp32 bits
+    std::uint32_t offset;        // fp32 bits, 0 for symmetric tables
+    std::uint32_t constant;      // fp32 bits of C, quadratic tables only
+};
+
+/**
+ * @brief Evaluates the table loaded by _init_lut_ over ITERATIONS row groups.
+ *
+ * Costs one MAD for the input mapping, one SFPLUTFP32 and, for quadratic tables, one more MAD per row group;
+ * LutSymmetry::Clamp adds a conditional move.
+ */
+template <LutSymmetry SYMMETRY, bool QUADRATIC, int LUT_MODE, int ITERATIONS>
+inline void _calculate_lut_()
+{
+    static_assert(LUT_MODE == 0 || LUT_MODE == 1, "Only the two 6-entry FP16 table layouts are supported");
+
+    sfpi::vUInt l0 = sfpi::l_reg[sfpi::LRegs::LReg0];
+    sfpi::vUInt l1 = sfpi::l_reg[sfpi::LRegs::LReg1];
+    sfpi::vUInt l2 = sfpi::l_reg[sfpi::LRegs::LReg2];
+    sfpi::vUInt l4 = sfpi::l_reg[sfpi::LRegs::LReg4];
+    sfpi::vUInt l5 = sfpi::l_reg[sfpi::LRegs::LReg5];
+    sfpi::vUInt l6 = sfpi::l_reg[sfpi::LRegs::LReg6];
+
+#pragma GCC unroll 8
+    for (int d = 0; d < ITERATIONS; d++)
+    {
+        sfpi::vFloat t = sfpi::dst_reg[0] * sfpi::vConstFloatPrgm0 + sfpi::vConstFloatPrgm1;
+
+        if constexpr (SYMMETRY == LutSymmetry::Clamp)
+        {
+            v_if (t < 0.0f)
+            {
+                t = 0.0f;
+            }
+            v_endif;
+        }
+
+        // lut2 gives the segment value the sign of t, lut2_sign keeps it as computed. A quadratic multiplies by t
+        // once more, which flips the parity, so it uses the opposite form.
+        constexpr bool ODD_LUT = (SYMMETRY == LutSymmetry::Odd) != QUADRATIC;
+
+        sfpi::vFloat result;
+        if constexpr (ODD_LUT)
+        {
+            result = lut2(t, l0, l1, l2, l4, l5, l6, LUT_MODE);
+        }
+        else
+        {
+            result = lut2_sign(t, l0, l1, l2, l4, l5, l6, LUT_MODE);
+        }
+
+        if constexpr (QUADRATIC)
+        {
+            result = result * t + sfpi::vConstFloatPrgm2;
+        }
+
+        sfpi::dst_reg[0] = result;
+        sfpi::dst_reg++;
+    }
+
+    sfpi::l_reg[sfpi::LRegs::LReg0] = l0;
+    sfpi::l_reg[sfpi::LRegs::LReg1] = l1;
+    sfpi::l_reg[sfpi::LRegs::LReg2] = l2;
+    sfpi::l_reg[sfpi::LRegs::LReg4] = l4;
+    sfpi::l_reg[sfpi::LRegs::LReg5] = l5;
+    sfpi::l_reg[sfpi::LRegs::LReg6] = l6;
+}
+
+// Writes a 32-bit word to one of the programmable constant registers LREG11-14; unlike _sfpu_load_config32_, the
+// word does not have to be a compile-time constant
+inline void _sfpu_lut_load_constant_(const std::uint32_t dest, const std::uint32_t value)
+{
+    _sfpu_load_imm32_(p_sfpu::LREG0, value);
+    TT_SFPCONFIG(0, dest, 0);
+}
+
+/**
+ * @brief Loads a table for _calculate_lut_.
+ *
+ * Occupies LREG0-2 and LREG4-6 and the programmable constants LREG12-14 (vConstFloatPrgm0-2), so it has to be rerun
+ * after any op that reprograms them.
+ */
+inline void _init_lut_(const SfpuLutTable &table)
+{
+    _sfpu_lut_load_constant_(p_sfpu::LREG12, table.scale);
+    _sfpu_lut_load_constant_(p_sfpu::LREG13, table.offset);
+    _sfpu_lut_load_constant_(p_sfpu::LREG14, table.constant);
+
+    // LREG0 doubles as the staging register of the constant loads, so the table goes in last
+    for (std::uint32_t i = 0; i < 3; i++)
+    {
+        _sfpu_load_imm32_(p_sfpu::LREG0 + i, table.slopes[i]);
+        _sfpu_load_imm32_(p_sfpu::LREG4 + i, table.intercepts[i]);
+    }
+}
+
+} // namespace ckernel::sfpu
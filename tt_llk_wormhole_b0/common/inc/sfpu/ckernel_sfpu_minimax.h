@@ -0,0 +1,411 @@
+// SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <utility>
+
+#include "ckernel_sfpu_polyval.h"
+#include "sfpi.h"
+
+namespace ckernel::sfpu
+{
+
+// ============================================================================
+// Compile-time minimax polynomial fitting
+// ============================================================================
+// Kernels pick their polynomial by (function, interval, accuracy target) instead of pasting coefficients:
+//
+//   constexpr int DEGREE = minimax_degree<MinimaxExp>(-0.35, 0.35, bf16_ulps(1));
+//   static_assert(DEGREE <= 8, "No polynomial of degree <= 8 meets the bound");
+//   constexpr auto FIT   = minimax_fit<MinimaxExp, DEGREE>(-0.35, 0.35);
+//   sfpi::vFloat y       = minimax_eval(x, FIT);
+//
+// minimax_degree returns the lowest degree whose minimax error meets the bound, so a bf16 consumer does not pay for
+// fp32-grade accuracy. The fit runs a discrete Remez exchange in double precision on the compiler; everything is
+// constexpr, so the coefficients are folded into the kernel as immediates. Reference functions provide
+//   static constexpr double eval(double x);
+//   static constexpr bool RELATIVE;   // minimize relative rather than absolute error
+// RELATIVE fits must not contain a root of the function.
+
+// Relative error bounds that guarantee at most `ulps` units in the last place
+constexpr double bf16_ulps(const double ulps)
+{
+    return ulps * 0x1p-8;
+}
+
+constexpr double fp32_ulps(const double ulps)
+{
+    return ulps * 0x1p-24;
+}
+
+template <int DEGREE>
+struct MinimaxFit
+{
+    std::array<double, DEGREE + 1> coefficients {}; // ascending powers
+    double max_error = 0.0;                         // of the same kind as the fit: relative or absolute
+};
+
+namespace internal
+{
+
+constexpr double cx_abs(const double x)
+{
+    return x < 0.0 ? -x : x;
+}
+
+constexpr double cx_exp(const double x)
+{
+    // exp(x) = 2^k * exp(r), |r| <= ln2 / 2
+    constexpr double LN2 = 0.6931471805599453094;
+    const int k          = static_cast<int>(x / LN2 + (x < 0.0 ? -0.5 : 0.5));
+    const double r       = x - k * LN2;
+
+    double term = 1.0;
+    double sum  = 1.0;
+    for (int i = 1; i < 18; i++)
+    {
+        term *= r / i;
+        sum += term;
+    }
+
+    const double base = k < 0 ? 0.5 : 2.0;
+    for (int i = 0; i < (k < 0 ? -k : k); i++)
+    {
+        sum *= base;
+    }
+    return sum;
+}
+
+constexpr double cx_log(double x)
+{
+    // x = m * 2^e with m in [1, 2); log(m) = 2 * atanh((m - 1) / (m + 1))
+    constexpr double LN2 = 0.6931471805599453094;
+    int e                = 0;
+    while (x >= 2.0)
+    {
+        x *= 0.5;
+        e++;
+    }
+    while (x < 1.0)
+    {
+        x *= 2.0;
+        e--;
+    }
+
+    const double s  = (x - 1.0) / (x + 1.0);
+    const double s2 = s * s;
+    double term     = s;
+    double sum      = 0.0;
+    for (int i = 1; i < 60; i += 2)
+    {
+        sum += term / i;
+        term *= s2;
+    }
+    return 2.0 * sum + e * LN2;
+}
+
+constexpr double cx_cos(const double x)
+{
+    // Only used for Chebyshev nodes, x in [0, pi]
+    double term = 1.0;
+    double sum  = 1.0;
+    for (int i = 1; i < 30; i++)
+    {
+        term *= -x * x / ((2 * i - 1) * (2 * i));
+        sum += term;
+    }
+    return sum;
+}
+
+template <int DEGREE>
+constexpr double poly_eval(const std::array<double, DEGREE + 1> &coefficients, const double x)
+{
+    double result = 0.0;
+    for (int i = DEGREE; i >= 0; i--)
+    {
+        result = result * x + coefficients[i];
+    }
+    return result;
+}
+
+// Function and error weight sampled once on the grid; the Remez steps only evaluate polynomials
+template <typename Function, int GRID>
+struct Samples
+{
+    std::array<double, GRID + 1> x {};
+    std::array<double, GRID + 1> f {};
+    std::array<double, GRID + 1> w {}; // 1 / |f| for relative fits
+};
+
+template <typename Function, int GRID>
+constexpr Samples<Function, GRID> sample(const double lo, const double hi)
+{
+    Samples<Function, GRID> samples {};
+    for (int g = 0; g <= GRID; g++)
+    {
+        samples.x[g] = lo + (hi - lo) * g / GRID;
+        samples.f[g] = Function::eval(samples.x[g]);
+        samples.w[g] = Function::RELATIVE ? 1.0 / cx_abs(samples.f[g]) : 1.0;
+    }
+    return samples;
+}
+
+// Solves p(x_i) + (-1)^i * E / w(x_i) = f(x_i) over the reference grid points for the DEGREE + 1 coefficients and the
+// levelled error E
+template <int DEGREE, typename Function, int GRID>
+constexpr MinimaxFit<DEGREE> solve_reference(const Samples<Function, GRID> &samples, const std::array<int, DEGREE + 2> &reference)
+{
+    constexpr int N = DEGREE + 2;
+    std::array<std::array<double, N + 1>, N> m {};
+
+    for (int i = 0; i < N; i++)
+    {
+        const int g  = reference[i];
+        double power = 1.0;
+        for (int j = 0; j <= DEGREE; j++)
+        {
+            m[i][j] = power;
+            power *= samples.x[g];
+        }
+        m[i][N - 1] = ((i & 1) ? -1.0 : 1.0) / samples.w[g];
+        m[i][N]     = samples.f[g];
+    }
+
+    // Gaussian elimination with partial pivoting
+    for (int col = 0; col < N; col++)
+    {
+        int pivot = col;
+        for (int row = col + 1; row < N; row++)
+        {
+            if (cx_abs(m[row][col]) > cx_abs(m[pivot][col]))
+            {
+                pivot = row;
+            }
+        }
+        for (int k = 0; k <= N; k++)
+        {
+            const double tmp = m[col][k];
+            m[col][k]        = m[pivot][k];
+            m[pivot][k]      = tmp;
+        }
+
+        for (int row = col + 1; row < N; row++)
+        {
+            const double factor = m[row][col] / m[col][col];
+            for (int k = col; k <= N; k++)
+            {
+                m[row][k] -= factor * m[col][k];
+            }
+        }
+    }
+
+    std::array<double, N> solution {};
+    for (int row = N - 1; row >= 0; row--)
+    {
+        double sum = m[row][N];
+        for (int k = row + 1; k < N; k++)
+        {
+            sum -= m[row][k] * solution[k];
+        }
+        solution[row] = sum / m[row][row];
+    }
+
+    MinimaxFit<DEGREE> fit {};
+    for (int j = 0; j <= DEGREE; j++)
+    {
+        fit.coefficients[j] = solution[j];
+    }
+    fit.max_error = cx_abs(solution[N - 1]);
+    return fit;
+}
+
+} // namespace internal
+
+/**
+ * @brief Minimax polynomial of degree DEGREE for Function on [lo, hi].
+ *
+ * Discrete Remez exchange on GRID + 1 equispaced points: starts from the points nearest the Chebyshev extrema, then
+ * moves the reference to the alternating extrema of the weighted error until it is levelled. max_error is the measured
+ * maximum over the grid.
+ */
+template <typename Function, int DEGREE, int GRID = 512, int STEPS = 10>
+constexpr MinimaxFit<DEGREE> minimax_fit(const double lo, const double hi)
+{
+    constexpr int N     = DEGREE + 2;
+    constexpr double PI = 3.14159265358979323846;
+
+    static_assert(GRID >= 4 * N, "Grid too coarse for the requested degree");
+
+    const internal::Samples<Function, GRID> samples = internal::sample<Function, GRID>(lo, hi);
+
+    std::array<int, N> reference {};
+    for (int i = 0; i < N; i++)
+    {
+        reference[i] = static_cast<int>(0.5 * GRID * (1.0 - internal::cx_cos(PI * i / (N - 1))) + 0.5);
+    }
+
+    MinimaxFit<DEGREE> fit {};
+    for (int step = 0; step < STEPS; step++)
+    {
+        fit = internal::solve_reference<DEGREE>(samples, reference);
+
+        // One extremum per run of equal error sign
+        std::array<int, GRID + 1> extrema_g {};
+        std::array<double, GRID + 1> extrema_e {};
+        int count        = 0;
+        double max_error = 0.0;
+        for (int g = 0; g <= GRID; g++)
+        {
+            const double e = (internal::poly_eval<DEGREE>(fit.coefficients, samples.x[g]) - samples.f[g]) * samples.w[g];
+            max_error      = internal::cx_abs(e) > max_error ? internal::cx_abs(e) : max_error;
+            if (count > 0 && ((e < 0.0) == (extrema_e[count - 1] < 0.0)))
+            {
+                if (internal::cx_abs(e) > internal::cx_abs(extrema_e[count - 1]))
+                {
+                    extrema_g[count - 1] = g;
+                    extrema_e[count - 1] = e;
+                }
+            }
+            else
+            {
+                extrema_g[count] = g;
+                extrema_e[count] = e;
+                count++;
+            }
+        }
+
+        // Levelled, or too few alternations left for the grid to resolve: done
+        const double levelled = fit.max_error;
+        fit.max_error         = max_error;
+        if (max_error <= levelled * 1.001 || count < N)
+        {
+            break;
+        }
+
+        // Drop the smaller end extremum until N remain; alternation is preserved
+        int first = 0;
+        int last  = count - 1;
+        while (last - first + 1 > N)
+        {
+            if (internal::cx_abs(extrema_e[first]) < internal::cx_abs(extrema_e[last]))
+            {
+                first++;
+            }
+            else
+            {
+                last--;
+            }
+        }
+        for (int i = 0; i < N; i++)
+        {
+            reference[i] = extrema_g[first + i];
+        }
+    }
+
+    return fit;
+}
+
+namespace internal
+{
+
+template <typename Function, std::size_t... DEGREE_MINUS_ONE>
+constexpr int lowest_degree(const double lo, const double hi, const double max_error, std::index_sequence<DEGREE_MINUS_ONE...>)
+{
+    int degree = static_cast<int>(sizeof...(DEGREE_MINUS_ONE)) + 1;
+    // Ascending, so the first degree to meet the bound wins
+    ((degree > static_cast<int>(DEGREE_MINUS_ONE) + 1 && minimax_fit<Function, static_cast<int>(DEGREE_MINUS_ONE) + 1>(lo, hi).max_error <= max_error
+          ? (degree = static_cast<int>(DEGREE_MINUS_ONE) + 1)
+          : 0),
+     ...);
+    return degree;
+}
+
+template <typename T, int DEGREE, std::size_t... I>
+sfpi_inline T eval_fit(const T x, const MinimaxFit<DEGREE> &fit, std::index_sequence<I...>)
+{
+    return PolynomialEvaluator::eval(x, static_cast<float>(fit.coefficients[I])...);
+}
+
+} // namespace internal
+
+/**
+ * @brief Lowest degree in [1, MAX_DEGREE] whose minimax fit of Function on [lo, hi] stays within max_error.
+ *
+ * Returns MAX_DEGREE + 1 when no degree meets the bound; callers static_assert on the result.
+ */
+template <typename Function, int MAX_DEGREE = 8>
+constexpr int minimax_degree(const double lo, const double hi, const double max_error)
+{
+    return internal::lowest_degree<Function>(lo, hi, max_error, std::make_index_sequence<MAX_DEGREE> {});
+}
+
+/**
+ * @brief Evaluates a minimax fit with Horner's method; coefficients are rounded to float immediates.
+ */
+template <typename T, int DEGREE>
+sfpi_inline T minimax_eval(const T x, const MinimaxFit<DEGREE> &fit)
+{
+    return internal::eval_fit(x, fit, std::make_index_sequence<DEGREE + 1> {});
+}
+
+// ============================================================================
+// Reference functions
+// ============================================================================
+
+struct MinimaxExp
+{
+    static constexpr bool RELATIVE = true;
+
+    static constexpr double eval(const double x)
+    {
+        return internal::cx_exp(x);
+    }
+};
+
+// log(x), fitted relative away from x = 1
+struct MinimaxLog
+{
+    static constexpr bool RELATIVE = true;
+
+    static constexpr double eval(const double x)
+    {
+        return internal::cx_log(x);
+    }
+};
+
+// log(1 + x)
+struct MinimaxLog1p
+{
+    static constexpr bool RELATIVE = false;
+
+    static constexpr double eval(const double x)
+    {
+        return internal::cx_log(1.0 + x);
+    }
+};
+
+struct MinimaxTanh
+{
+    static constexpr bool RELATIVE = false;
+
+    static constexpr double eval(const double x)
+    {
+        return 1.0 - 2.0 / (internal::cx_exp(2.0 * x) + 1.0);
+    }
+};
+
+struct MinimaxSigmoid
+{
+    static constexpr bool RELATIVE = true;
+
+    static constexpr double eval(const double x)
+    {
+        return 1.0 / (1.0 + internal::cx_exp(-x));
+    }
+};
+
+} // namespace ckernel::sfpu
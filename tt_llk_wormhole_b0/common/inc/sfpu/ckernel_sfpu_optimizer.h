@@ -0,0 +1,153 @@
+// SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+
+#include "ckernel_defs.h"
+#include "ckernel_sfpu_converter.h"
+#include "ckernel_sfpu_sqrt.h"
+#include "sfpi.h"
+
+namespace ckernel::sfpu
+{
+
+// ============================================================================
+// Fused optimizer steps
+// ============================================================================
+// Updates a parameter tile and its optimizer state in place from a gradient tile, in one dest pass instead of a dozen
+// elementwise calls. With g the gradient, p the parameter, m and v the first and second moments:
+//   ADAM:  g = g + weight_decay * p, then as ADAMW without the decay term
+//   ADAMW: m = beta1 * m + (1 - beta1) * g
+//          v = beta2 * v + (1 - beta2) * g^2
+//          p = p - weight_decay * p - step_size * m / (sqrt(v) * rsqrt_bias_correction2 + eps)
+//   LION:  p = p - weight_decay * p - step_size * sign(beta1 * m + (1 - beta1) * g)
+//          m = beta2 * m + (1 - beta2) * g
+// The moment updates are evaluated as (m - g) * beta + g, which needs no 1 - beta constant. The scalars depend on the
+// step count only, so the caller computes them once per step for all tiles of a tensor (see SfpuOptimizerParams).
+
+struct SfpuOptimizerParams
+{
+    std::uint32_t beta1;                  // fp32 bits
+    std::uint32_t beta2;                  // fp32 bits
+    std::uint32_t eps;                    // fp32 bits, Adam(W) only
+    std::uint32_t step_size;              // fp32 bits of lr / (1 - beta1^t) for Adam(W), lr for Lion
+    std::uint32_t rsqrt_bias_correction2; // fp32 bits of 1 / sqrt(1 - beta2^t), Adam(W) only
+    std::uint32_t weight_decay;           // fp32 bits of weight_decay for Adam, lr * weight_decay for AdamW and Lion
+};
+
+// Stores optimizer state, rounding it to bfloat16 when dest is 16-bit
+template <bool is_fp32_dest_acc_en>
+sfpi_inline void _sfpu_optimizer_store_(const std::uint32_t offset, const sfpi::vFloat value)
+{
+    if constexpr (is_fp32_dest_acc_en)
+    {
+        sfpi::dst_reg[offset] = value;
+    }
+    else
+    {
+        sfpi::dst_reg[offset] = sfpi::reinterpret<sfpi::vFloat>(float_to_fp16b(value, 0));
+    }
+}
+
+/**
+ * @brief Applies one OPTIMIZER step to one face of the parameter tile and its state tiles.
+ *
+ * Writes the parameter, m and v tiles back in place; the gradient tile is left unchanged, and Lion neither reads nor
+ * writes dst_index_exp_avg_sq. Run through _llk_math_eltwise_ternary_sfpu_params_ with VectorMode::RC, with
+ * dst_index_exp_avg_sq in the output slot. Requires _sfpu_optimizer_init_.
+ *
+ * Without a 32-bit dest the state is rounded to bfloat16 on every store, which loses small updates; keep optimizer
+ * state in fp32 whenever possible.
+ */
+template <bool APPROXIMATION_MODE, OptimizerType OPTIMIZER, bool is_fp32_dest_acc_en, int ITERATIONS = 8>
+inline void _calculate_sfpu_optimizer_(
+    const std::uint32_t dst_index_param,
+    const std::uint32_t dst_index_grad,
+    const std::uint32_t dst_index_exp_avg,
+    const std::uint32_t dst_index_exp_avg_sq,
+    const SfpuOptimizerParams &params)
+{
+    // size of each tile in Dest is 64/SFP_DESTREG_STRIDE = 32 rows when using sfpi to load/store
+    constexpr std::uint32_t dst_tile_size_sfpi = 32;
+
+    const std::uint32_t param_base      = dst_index_param * dst_tile_size_sfpi;
+    const std::uint32_t grad_base       = dst_index_grad * dst_tile_size_sfpi;
+    const std::uint32_t exp_avg_base    = dst_index_exp_avg * dst_tile_size_sfpi;
+    const std::uint32_t exp_avg_sq_base = dst_index_exp_avg_sq * dst_tile_size_sfpi;
+
+    const float beta1        = Converter::as_float(params.beta1);
+    const float beta2        = Converter::as_float(params.beta2);
+    const float eps          = Converter::as_float(params.eps);
+    const float step_size    = Converter::as_float(params.step_size);
+    const float rsqrt_bc2    = Converter::as_float(params.rsqrt_bias_correction2);
+    const float weight_decay = Converter::as_float(params.weight_decay);
+
+#pragma GCC unroll 0
+    for (int d = 0; d < ITERATIONS; d++)
+    {
+        sfpi::vFloat p = sfpi::dst_reg[param_base];
+        sfpi::vFloat g = sfpi::dst_reg[grad_base];
+        sfpi::vFloat m = sfpi::dst_reg[exp_avg_base];
+
+        if constexpr (OPTIMIZER == OptimizerType::LION)
+        {
+            sfpi::vFloat c = (m - g) * beta1 + g;
+            m              = (m - g) * beta2 + g;
+            _sfpu_optimizer_store_<is_fp32_dest_acc_en>(exp_avg_base, m);
+
+            p = p - weight_decay * p;
+            v_if (c > 0.0f)
+            {
+                p = p - step_size;
+            }
+            v_elseif (c < 0.0f)
+            {
+                p = p + step_size;
+            }
+            v_endif;
+        }
+        else
+        {
+            if constexpr (OPTIMIZER == OptimizerType::ADAM)
+            {
+                g = weight_decay * p + g;
+            }
+
+            m = (m - g) * beta1 + g;
+            _sfpu_optimizer_store_<is_fp32_dest_acc_en>(exp_avg_base, m);
+
+            sfpi::vFloat g2 = g * g;
+            sfpi::vFloat v  = sfpi::dst_reg[exp_avg_sq_base];
+            v               = (v - g2) * beta2 + g2;
+            _sfpu_optimizer_store_<is_fp32_dest_acc_en>(exp_avg_sq_base, v);
+
+            // 1 / denom as rsqrt(denom)^2, so that the whole step runs on the constants of _init_sqrt_
+            sfpi::vFloat denom     = _calculate_sqrt_body_<APPROXIMATION_MODE>(v) * rsqrt_bc2 + eps;
+            sfpi::vFloat inv_denom = _calculate_sqrt_body_<APPROXIMATION_MODE, true>(denom);
+            inv_denom              = inv_denom * inv_denom;
+
+            if constexpr (OPTIMIZER == OptimizerType::ADAMW)
+            {
+                p = p - weight_decay * p;
+            }
+            p = p - step_size * m * inv_denom;
+        }
+
+        _sfpu_optimizer_store_<is_fp32_dest_acc_en>(param_base, p);
+        sfpi::dst_reg++;
+    }
+}
+
+template <bool APPROXIMATION_MODE, OptimizerType OPTIMIZER>
+inline void _sfpu_optimizer_init_()
+{
+    if constexpr (OPTIMIZER != OptimizerType::LION)
+    {
+        _init_sqrt_<APPROXIMATION_MODE>();
+    }
+}
+
+} // namespace ckernel::sfpu
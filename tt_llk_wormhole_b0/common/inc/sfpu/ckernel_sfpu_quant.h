@@ -6,6 +6,7 @@
 
 #include <cstdint>
 
+#include "ckernel_addrmod.h"
 #include "ckernel_ops.h"
 #include "ckernel_sfpu_load_config.h"
 #include "sfpi.h"
@@ -109,6 +110,73 @@ inline void _dequant_int32_(const std::uint32_t dst_index_in0, const std::uint32
     }
 }
 
+/**
+ * @brief Fused requantisation of int32 matmul accumulators to int8 or uint8 with a scale per output channel.
+ *
+ *   out = saturate(round(RELU ? max(acc * scale[n], 0) + zero_point : acc * scale[n] + zero_point))
+ *
+ * with n the column of the element. The scales are tile row 0 of dst_index_scale, broadcast down the columns by
+ * _calculate_sfpu_binary_bcast_prepare_<APPROXIMATION_MODE, BinaryOp::MUL, BroadcastType::ROW> (ckernel_sfpu_binary.h),
+ * which is run once per scale tile. The zero point comes from _init_quant_zero_point_. UNSIGNED_OUTPUT saturates to
+ * [0, 255] instead of [-128, 127]. The result is stored as int32, like _requant_int32_.
+ *
+ * Replaces a dequant, a ReLU and a quant pass over the tile, and the intermediate fp32 tile between them. Covers the
+ * whole tile in one call; run with VectorMode::None.
+ */
+template <bool APPROXIMATION_MODE, bool SIGN_MAGNITUDE_FORMAT, bool RELU, bool UNSIGNED_OUTPUT>
+inline void _requant_int32_per_channel_(const std::uint32_t dst_index_in0, const std::uint32_t dst_index_scale, const std::uint32_t dst_index_out)
+{
+    // size of each tile in Dest is 64 rows
+    constexpr std::uint32_t dst_tile_size = 64;
+
+    const std::uint32_t in0_base   = dst_index_in0 * dst_tile_size;
+    const std::uint32_t scale_base = dst_index_scale * dst_tile_size;
+    const std::uint32_t out_base   = dst_index_out * dst_tile_size;
+
+    constexpr std::uint32_t round_mod = UNSIGNED_OUTPUT ? sfpi::SFPSTOCHRND_MOD1_FP32_TO_UINT8 : sfpi::SFPSTOCHRND_MOD1_FP32_TO_INT8;
+
+#pragma GCC unroll 0
+    for (std::uint32_t face = 0; face < 4; face++)
+    {
+        // Row group 0 of the face in the same column of faces holds the broadcast scales
+        const std::uint32_t scale_face = scale_base + (face & 1) * 16;
+
+#pragma GCC unroll 8
+        for (std::uint32_t d = 0; d < 8; d++)
+        {
+            const std::uint32_t e = face * 16 + d * 2;
+
+            // operand A - int32
+            TT_SFPLOAD(p_sfpu::LREG0, SIGN_MAGNITUDE_FORMAT ? 4 : 12, ADDR_MOD_3, in0_base + e);
+            // scales of the same column half
+            TT_SFPLOAD(p_sfpu::LREG1, 3, ADDR_MOD_3, scale_face + (d & 1) * 2);
+            // cast int32->fp32
+            TTI_SFPCAST(p_sfpu::LREG0, p_sfpu::LREG0, 0);
+            if constexpr (RELU)
+            {
+                TTI_SFPMUL(p_sfpu::LREG0, p_sfpu::LREG1, p_sfpu::LCONST_0, p_sfpu::LREG0, 0);
+                TTI_NOP;
+                // Clamp negative values to zero before the zero point is added
+                TTI_SFPSETCC(0, p_sfpu::LREG0, 0, sfpi::SFPSETCC_MOD1_LREG_LT0);
+                TTI_SFPMOV(0, p_sfpu::LCONST_0, p_sfpu::LREG0, 0);
+                TTI_SFPENCC(0, 0, 0, 0);
+                // D(A) = A*1+C, LREG[2] = zero_point
+                TTI_SFPADD(p_sfpu::LREG0, p_sfpu::LCONST_1, p_sfpu::LREG2, p_sfpu::LREG0, 0);
+            }
+            else
+            {
+                // D(A) = A*B+C, LREG[2] = zero_point
+                TTI_SFPMAD(p_sfpu::LREG0, p_sfpu::LREG1, p_sfpu::LREG2, p_sfpu::LREG0, 0);
+            }
+            TTI_NOP;
+            // fp32->int8 or uint8 with saturation, descale value is zero (LREG_9)
+            TTI_SFP_STOCH_RND(0, 0, p_sfpu::LCONST_0, p_sfpu::LREG0, p_sfpu::LREG0, round_mod);
+            // LREG_0 -> dest as int32
+            TT_SFPSTORE(p_sfpu::LREG0, SIGN_MAGNITUDE_FORMAT ? 4 : 12, ADDR_MOD_3, out_base + e);
+        }
+    }
+}
+
 template <bool APPROXIMATION_MODE /*unused*/>
 inline void _init_quant_zero_point_(const std::uint32_t zero_point)
 {
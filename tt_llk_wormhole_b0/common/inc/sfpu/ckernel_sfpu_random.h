@@ -0,0 +1,218 @@
+// SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+
+#include "ckernel_sfpu_converter.h"
+#include "sfpi.h"
+
+namespace ckernel::sfpu
+{
+
+// ============================================================================
+// Counter-based random numbers
+// ============================================================================
+// The hardware PRNG behind SFPMOV is a single stream, so the numbers a tile gets depend on everything the SFPU drew
+// before it. Threefry-2x32 (Salmon et al., "Parallel random numbers: as easy as 1, 2, 3", SC'11) instead hashes a
+// counter under a key, so every element gets the same number whenever and wherever it is computed:
+//   key     = (seed, stream)                      programmed once by _init_threefry_
+//   counter = (pair index in the tile, tile_index)
+// A backward pass can regenerate a dropout mask from (seed, stream, tile_index) instead of storing it.
+//
+// Threefry needs only 32-bit add, rotate and xor; Philox would need a 32x32->64 bit multiply, which the SFPU lacks.
+// One evaluation yields two words, used for the even and odd columns at the same position (sfpi offsets 2i and
+// 2i + 1), so the 20 rounds cost about 60 instructions per row of 32 elements. Random123 finds 13 rounds to be enough
+// to pass BigCrush, so ROUNDS = 16 is a valid cheaper choice. tests/python_tests/helpers/threefry.py mirrors the
+// generator on the host.
+
+// The three key schedule words live in the programmable constants, which leaves the LREGs for the rounds
+inline void _init_threefry_(const std::uint32_t seed, const std::uint32_t stream = 0)
+{
+    sfpi::vConstIntPrgm0 = static_cast<int>(seed);
+    sfpi::vConstIntPrgm1 = static_cast<int>(stream);
+    sfpi::vConstIntPrgm2 = static_cast<int>(seed ^ stream ^ 0x1BD11BDA);
+}
+
+template <int I>
+sfpi_inline sfpi::vUInt _threefry_key_()
+{
+    if constexpr (I % 3 == 0)
+    {
+        return sfpi::reinterpret<sfpi::vUInt>(sfpi::vConstIntPrgm0);
+    }
+    else if constexpr (I % 3 == 1)
+    {
+        return sfpi::reinterpret<sfpi::vUInt>(sfpi::vConstIntPrgm1);
+    }
+    else
+    {
+        return sfpi::reinterpret<sfpi::vUInt>(sfpi::vConstIntPrgm2);
+    }
+}
+
+template <int R>
+sfpi_inline void _threefry_mix_(sfpi::vUInt &x0, sfpi::vUInt &x1)
+{
+    x0 = x0 + x1;
+    x1 = (x1 << R) | (x1 >> (32 - R));
+    x1 = x1 ^ x0;
+}
+
+// Four rounds followed by key injection GROUP + 1
+template <int GROUP, int GROUPS>
+sfpi_inline void _threefry_groups_(sfpi::vUInt &x0, sfpi::vUInt &x1)
+{
+    if constexpr (GROUP < GROUPS)
+    {
+        if constexpr (GROUP % 2 == 0)
+        {
+            _threefry_mix_<13>(x0, x1);
+            _threefry_mix_<15>(x0, x1);
+            _threefry_mix_<26>(x0, x1);
+            _threefry_mix_<6>(x0, x1);
+        }
+        else
+        {
+            _threefry_mix_<17>(x0, x1);
+            _threefry_mix_<29>(x0, x1);
+            _threefry_mix_<16>(x0, x1);
+            _threefry_mix_<24>(x0, x1);
+        }
+        x0 = x0 + _threefry_key_<GROUP + 1>();
+        x1 = x1 + _threefry_key_<GROUP + 2>() + (GROUP + 1);
+
+        _threefry_groups_<GROUP + 1, GROUPS>(x0, x1);
+    }
+}
+
+/**
+ * @brief Replaces the counter (x0, x1) with its Threefry-2x32 hash under the key programmed by _init_threefry_.
+ */
+template <int ROUNDS = 20>
+sfpi_inline void _sfpu_threefry2x32_(sfpi::vUInt &x0, sfpi::vUInt &x1)
+{
+    static_assert(ROUNDS % 4 == 0 && ROUNDS >= 12, "Threefry injects the key every 4 rounds; use 12 to 20 rounds");
+
+    x0 = x0 + _threefry_key_<0>();
+    x1 = x1 + _threefry_key_<1>();
+    _threefry_groups_<0, ROUNDS / 4>(x0, x1);
+}
+
+// Lane index l, which starts counter word 0 at p * 32 + l for pair p of a tile; vConstTileId holds 2 * l
+sfpi_inline sfpi::vUInt _threefry_lane_counter_()
+{
+    return sfpi::reinterpret<sfpi::vUInt>(sfpi::vConstTileId) >> 1;
+}
+
+// Maps 32 random bits to [1, 2) through the top 23 bits
+sfpi_inline sfpi::vFloat _threefry_to_float_1_2_(const sfpi::vUInt bits)
+{
+    return sfpi::reinterpret<sfpi::vFloat>((bits >> 9) | 0x3F800000);
+}
+
+/**
+ * @brief Fills the tile with uniform random values in [lo, lo + range), from the counters of tile_index.
+ *
+ * lo and range are fp32 bits. Covers the whole tile in one call; run with VectorMode::None. Requires _init_threefry_.
+ */
+template <bool APPROXIMATION_MODE, int ROUNDS = 20>
+inline void _calculate_rand_threefry_(const std::uint32_t tile_index, const std::uint32_t lo, const std::uint32_t range)
+{
+    const float lo_f    = Converter::as_float(lo);
+    const float range_f = Converter::as_float(range);
+
+    sfpi::vUInt counter = _threefry_lane_counter_();
+
+#pragma GCC unroll 0
+    for (int pair = 0; pair < 16; pair++)
+    {
+        sfpi::vUInt x0 = counter;
+        sfpi::vUInt x1 = tile_index;
+        _sfpu_threefry2x32_<ROUNDS>(x0, x1);
+
+        sfpi::dst_reg[0] = (_threefry_to_float_1_2_(x0) - sfpi::vConst1) * range_f + lo_f;
+        sfpi::dst_reg[1] = (_threefry_to_float_1_2_(x1) - sfpi::vConst1) * range_f + lo_f;
+
+        counter = counter + 32;
+        sfpi::dst_reg++;
+        sfpi::dst_reg++;
+    }
+}
+
+// Rounds in to MAN_BITS mantissa bits, up with probability equal to the dropped fraction, from 32 random bits.
+// Infinities and NaNs pass through.
+template <int MAN_BITS, int MIN_EXP>
+sfpi_inline sfpi::vFloat _threefry_stochastic_round_(const sfpi::vFloat in, const sfpi::vUInt bits)
+{
+    constexpr int DROPPED_BITS    = 23 - MAN_BITS;
+    constexpr int MIN_NORMAL_BITS = (127 + MIN_EXP) << 23;
+
+    sfpi::vUInt mag = sfpi::reinterpret<sfpi::vUInt>(sfpi::setsgn(in, 0));
+    v_if (sfpi::reinterpret<sfpi::vInt>(mag) < 0x7F800000)
+    {
+        if constexpr (MIN_EXP > -126)
+        {
+            // Below the smallest normal of the target its grid stops shrinking. Adding the smallest normal moves the
+            // value into the binade whose grid that is, so the same dropped bits round it once, onto the final grid.
+            const sfpi::vFloat min_normal = sfpi::s2vFloat16b((127 + MIN_EXP) << 7);
+            v_if (sfpi::reinterpret<sfpi::vInt>(mag) < MIN_NORMAL_BITS)
+            {
+                sfpi::vUInt biased = sfpi::reinterpret<sfpi::vUInt>(sfpi::reinterpret<sfpi::vFloat>(mag) + min_normal);
+                biased             = (biased + (bits >> (32 - DROPPED_BITS))) & ~((1 << DROPPED_BITS) - 1);
+                mag                = sfpi::reinterpret<sfpi::vUInt>(sfpi::reinterpret<sfpi::vFloat>(biased) - min_normal);
+            }
+            v_else
+            {
+                mag = (mag + (bits >> (32 - DROPPED_BITS))) & ~((1 << DROPPED_BITS) - 1);
+            }
+            v_endif;
+        }
+        else
+        {
+            // A carry out of the mantissa bumps the exponent
+            mag = (mag + (bits >> (32 - DROPPED_BITS))) & ~((1 << DROPPED_BITS) - 1);
+        }
+    }
+    v_endif;
+    return sfpi::setsgn(sfpi::reinterpret<sfpi::vFloat>(mag), in);
+}
+
+/**
+ * @brief Stochastically rounds the fp32 tile in dest to MAN_BITS mantissa bits, from the counters of tile_index.
+ *
+ * The packer rounds stochastically only into Float16_b and the Bfp formats (_llk_pack_configure_stoch_rnd_), and from
+ * the hardware PRNG. This is the pre-pack pass for the other narrow targets, e.g. MAN_BITS = 10, MIN_EXP = -14 before
+ * packing to Float16, or 3, -6 before _calculate_typecast_fp32_to_fp8_ to E4M3, and for training runs that must round
+ * the same way on every replay. MIN_EXP is the exponent of the target's smallest normal: values below it are rounded
+ * onto the target's subnormal grid, so that the pack or typecast after this has nothing left to round. Bits of such a
+ * value below 2^(MIN_EXP - 23) go through the rounding of an SFPU add first. Covers the whole tile in one call; run
+ * with VectorMode::None. Requires _init_threefry_.
+ */
+template <bool APPROXIMATION_MODE, int MAN_BITS, int MIN_EXP = -126, int ROUNDS = 20>
+inline void _calculate_stochastic_round_threefry_(const std::uint32_t tile_index)
+{
+    static_assert(MAN_BITS > 0 && MAN_BITS < 23, "MAN_BITS must be in [1, 22]");
+    static_assert(MIN_EXP >= -126 && MIN_EXP <= 127, "MIN_EXP must be a normal fp32 exponent");
+
+    sfpi::vUInt counter = _threefry_lane_counter_();
+
+#pragma GCC unroll 0
+    for (int pair = 0; pair < 16; pair++)
+    {
+        sfpi::vUInt x0 = counter;
+        sfpi::vUInt x1 = tile_index;
+        _sfpu_threefry2x32_<ROUNDS>(x0, x1);
+
+        sfpi::dst_reg[0] = _threefry_stochastic_round_<MAN_BITS, MIN_EXP>(sfpi::dst_reg[0], x0);
+        sfpi::dst_reg[1] = _threefry_stochastic_round_<MAN_BITS, MIN_EXP>(sfpi::dst_reg[1], x1);
+
+        counter = counter + 32;
+        sfpi::dst_reg++;
+        sfpi::dst_reg++;
+    }
+}
+
+} // namespace ckernel::sfpu
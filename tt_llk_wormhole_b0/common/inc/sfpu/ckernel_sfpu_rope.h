@@ -0,0 +1,140 @@
+// SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+
+#include "ckernel_defs.h"
+#include "ckernel_sfpu_trigonometry.h"
+#include "sfpi.h"
+
+namespace ckernel::sfpu
+{
+
+// Computes sin(angle) and cos(angle) with a single shared range reduction.
+// Accuracy degrades for |angle| approaching 32767*pi, the range of float_to_int16.
+template <bool APPROXIMATION_MODE>
+sfpi_inline void _sfpu_sin_cos_(const sfpi::vFloat angle, sfpi::vFloat &sin_out, sfpi::vFloat &cos_out)
+{
+    sfpi::vFloat v             = 0.318309886183791f * angle; // *1/pi to get number of pi rads.
+    sfpi::vInt whole_v         = sfpi::float_to_int16(v, 0);
+    sfpi::vFloat whole_v_float = sfpi::int32_to_float(whole_v, 0);
+    v                          = (v - whole_v_float) * 3.141592653589793f; // fractional * pi to get it in [-pi:pi]
+
+    sin_out = _sfpu_sine_maclaurin_series_<APPROXIMATION_MODE>(v);
+    cos_out = _sfpu_cosine_maclaurin_series_<APPROXIMATION_MODE>(v);
+
+    whole_v = whole_v & 0x1;
+    v_if (whole_v != 0)
+    {
+        // odd multiple of pi so flip both signs
+        sin_out = -sin_out;
+        cos_out = -cos_out;
+    }
+    v_endif;
+}
+
+/**
+ * @brief Rotary position embedding: rotates element pairs of a Q/K tile by per-element angles, in a single dest pass.
+ *
+ * For each pair (a, b) selected by MODE:
+ *   out_a = a * cos - b * sin
+ *   out_b = b * cos + a * sin
+ *
+ * RopeMode::Interleaved pairs adjacent columns (x[2i], x[2i+1]). SFPLOAD at an even dest offset reads the even
+ * columns of four rows and the following offset reads the odd columns, so lane i of both loads holds the two
+ * halves of one pair. The pair swap therefore costs no SFPSHFT2/SFPTRANSP shuffles. Run with VectorMode::RC.
+ *
+ * RopeMode::HalfSplit pairs x[i] with x[i + d/2] (rotate_half). The partner element lives partner_offset sfpi rows
+ * further into dest; cos/sin are read only at the first element of the pair, as they repeat across the two halves.
+ *   - head_dim == 32: partner_offset = 8 (face 0 with face 1, face 2 with face 3), run with VectorMode::C.
+ *   - head_dim == 32*2k: partner_offset = 32*k (tile t with tile t+k), run with VectorMode::RC on the first k tiles.
+ *
+ * If ANGLE_INPUT is set, dst_index_cos holds the rotation angle (position * inverse frequency) and sin/cos are
+ * computed on the fly; dst_index_sin is ignored. Otherwise dst_index_cos/dst_index_sin hold precomputed tables.
+ *
+ * dst_index_out may alias dst_index_in.
+ */
+template <bool APPROXIMATION_MODE, RopeMode MODE, bool ANGLE_INPUT = false, int ITERATIONS = 8>
+inline void _calculate_rope_(
+    const std::uint32_t dst_index_in,
+    const std::uint32_t dst_index_cos,
+    const std::uint32_t dst_index_sin,
+    const std::uint32_t dst_index_out,
+    const std::uint32_t partner_offset = 8)
+{
+    // size of each tile in Dest is 64/SFP_DESTREG_STRIDE = 32 rows when using sfpi to load/store
+    constexpr std::uint32_t dst_tile_size_sfpi = 32;
+
+    const std::uint32_t in_base  = dst_index_in * dst_tile_size_sfpi;
+    const std::uint32_t cos_base = dst_index_cos * dst_tile_size_sfpi;
+    const std::uint32_t sin_base = dst_index_sin * dst_tile_size_sfpi;
+    const std::uint32_t out_base = dst_index_out * dst_tile_size_sfpi;
+
+    if constexpr (MODE == RopeMode::Interleaved)
+    {
+        static_assert(ITERATIONS % 2 == 0, "Interleaved RoPE consumes even and odd columns in the same iteration");
+
+#pragma GCC unroll 0
+        for (int d = 0; d < ITERATIONS / 2; d++)
+        {
+            sfpi::vFloat x_even = sfpi::dst_reg[in_base];
+            sfpi::vFloat x_odd  = sfpi::dst_reg[in_base + 1];
+
+            sfpi::vFloat cos_even, cos_odd, sin_even, sin_odd;
+            if constexpr (ANGLE_INPUT)
+            {
+                _sfpu_sin_cos_<APPROXIMATION_MODE>(sfpi::dst_reg[cos_base], sin_even, cos_even);
+                _sfpu_sin_cos_<APPROXIMATION_MODE>(sfpi::dst_reg[cos_base + 1], sin_odd, cos_odd);
+            }
+            else
+            {
+                cos_even = sfpi::dst_reg[cos_base];
+                cos_odd  = sfpi::dst_reg[cos_base + 1];
+                sin_even = sfpi::dst_reg[sin_base];
+                sin_odd  = sfpi::dst_reg[sin_base + 1];
+            }
+
+            sfpi::vFloat out_even = x_even * cos_even - x_odd * sin_even;
+            sfpi::vFloat out_odd  = x_odd * cos_odd + x_even * sin_odd;
+
+            sfpi::dst_reg[out_base]     = out_even;
+            sfpi::dst_reg[out_base + 1] = out_odd;
+
+            sfpi::dst_reg++;
+            sfpi::dst_reg++;
+        }
+    }
+    else
+    {
+#pragma GCC unroll 0
+        for (int d = 0; d < ITERATIONS; d++)
+        {
+            sfpi::vFloat x_lo = sfpi::dst_reg[in_base];
+            sfpi::vFloat x_hi = sfpi::dst_reg[in_base + partner_offset];
+
+            sfpi::vFloat cos_v, sin_v;
+            if constexpr (ANGLE_INPUT)
+            {
+                _sfpu_sin_cos_<APPROXIMATION_MODE>(sfpi::dst_reg[cos_base], sin_v, cos_v);
+            }
+            else
+            {
+                cos_v = sfpi::dst_reg[cos_base];
+                sin_v = sfpi::dst_reg[sin_base];
+            }
+
+            sfpi::vFloat out_lo = x_lo * cos_v - x_hi * sin_v;
+            sfpi::vFloat out_hi = x_hi * cos_v + x_lo * sin_v;
+
+            sfpi::dst_reg[out_base]                  = out_lo;
+            sfpi::dst_reg[out_base + partner_offset] = out_hi;
+
+            sfpi::dst_reg++;
+        }
+    }
+}
+
+} // namespace ckernel::sfpu
@@ -0,0 +1,64 @@
+// SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+
+#include "ckernel_addrmod.h"
+#include "ckernel_instr_params.h"
+#include "sfpi.h"
+
+namespace ckernel::sfpu
+{
+
+// Offsets, in sfpi rows, of the eight 4-row groups of a tile: rows 0-15 live in faces 0/1, rows 16-31 in faces 2/3.
+// A group spans four loads: +0/+1 are the even/odd columns of the left face, +8/+9 those of the right face.
+constexpr std::uint32_t SFPU_ROW_GROUP_OFFSETS[8] = {0, 2, 4, 6, 16, 18, 20, 22};
+
+/**
+ * @brief Reduces two adjacent 4-row groups across their 8 lane columns and broadcasts the result to every column.
+ *
+ * Butterfly over rotations by 4, 2 and 1 columns: after each stage every column holds the reduction of twice as many
+ * columns as before, so no final rotate back to column 0 is needed. The two groups run in lockstep to hide the
+ * SFPSHFT2/SFPADD/SFPSWAP latency, as in the reduce kernels.
+ *
+ * @param load_addr Raw dest address of the first group; the second group is 4 rows further
+ * @param store_addr Raw dest address the reduced first group is written to; the second group is 4 rows further
+ */
+template <bool IS_MAX>
+inline void _sfpu_row_allreduce_x2_(const std::uint32_t load_addr, const std::uint32_t store_addr)
+{
+    TT_SFPLOAD(p_sfpu::LREG0, InstrModLoadStore::DEFAULT, ADDR_MOD_3, load_addr);
+    TT_SFPLOAD(p_sfpu::LREG4, InstrModLoadStore::DEFAULT, ADDR_MOD_3, load_addr + 4);
+
+#pragma GCC unroll 3
+    for (std::uint32_t rotate = 4; rotate > 0; rotate >>= 1)
+    {
+        TTI_SFPMOV(0, p_sfpu::LREG0, p_sfpu::LREG1, 0);
+        TTI_SFPMOV(0, p_sfpu::LREG4, p_sfpu::LREG5, 0);
+
+        for (std::uint32_t i = 0; i < rotate; i++)
+        {
+            TTI_SFPSHFT2(0, p_sfpu::LREG1, p_sfpu::LREG1, 3); // Rotate right by 1 column
+            TTI_SFPSHFT2(0, p_sfpu::LREG5, p_sfpu::LREG5, 3);
+        }
+
+        if constexpr (IS_MAX)
+        {
+            TTI_SFPSWAP(0, p_sfpu::LREG0, p_sfpu::LREG1, p_sfpswap::ALL_ROWS_MAX);
+            TTI_SFPSWAP(0, p_sfpu::LREG4, p_sfpu::LREG5, p_sfpswap::ALL_ROWS_MAX);
+        }
+        else
+        {
+            TTI_SFPADD(p_sfpu::LREG0, p_sfpu::LCONST_1, p_sfpu::LREG1, p_sfpu::LREG0, 0);
+            TTI_SFPADD(p_sfpu::LREG4, p_sfpu::LCONST_1, p_sfpu::LREG5, p_sfpu::LREG4, 0);
+        }
+    }
+
+    TT_SFPSTORE(p_sfpu::LREG0, InstrModLoadStore::DEFAULT, ADDR_MOD_3, store_addr);
+    TT_SFPSTORE(p_sfpu::LREG4, InstrModLoadStore::DEFAULT, ADDR_MOD_3, store_addr + 4);
+}
+
+} // namespace ckernel::sfpu
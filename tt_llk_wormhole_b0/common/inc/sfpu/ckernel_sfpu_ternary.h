@@ -0,0 +1,101 @@
+// SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+
+#include "ckernel_defs.h"
+#include "ckernel_sfpu_converter.h"
+#include "ckernel_sfpu_recip.h"
+#include "sfpi.h"
+
+namespace ckernel::sfpu
+{
+
+// ============================================================================
+// Fused ternary elementwise ops
+// ============================================================================
+// Each op reads three dest tiles a, b and c and writes one, replacing the two or three binary passes (and the
+// intermediate tiles) it would otherwise take:
+//   FMA:     a * b + c
+//   LERP:    a + c * (b - a)           torch.lerp(start = a, end = b, weight = c)
+//   ADDCMUL: a + value * b * c
+//   ADDCDIV: a + value * b / c
+//   CLAMP:   min(max(a, b), c)         torch.clamp(a, min = b, max = c), so c wins where b > c
+// value is a runtime scalar passed as fp32 bits and is ignored by the other ops.
+
+/**
+ * @brief Computes OP over one face of dst_index_in0, dst_index_in1 and dst_index_in2 into dst_index_out.
+ *
+ * Any of the tiles may alias. Run through _llk_math_eltwise_ternary_sfpu_params_ with VectorMode::RC.
+ * ADDCDIV requires _sfpu_ternary_init_.
+ */
+template <bool APPROXIMATION_MODE, TernaryOp OP, int ITERATIONS = 8>
+inline void _calculate_sfpu_ternary_(
+    const std::uint32_t dst_index_in0,
+    const std::uint32_t dst_index_in1,
+    const std::uint32_t dst_index_in2,
+    const std::uint32_t dst_index_out,
+    const std::uint32_t value = 0x3F800000 /* 1.0f */)
+{
+    // size of each tile in Dest is 64/SFP_DESTREG_STRIDE = 32 rows when using sfpi to load/store
+    constexpr std::uint32_t dst_tile_size_sfpi = 32;
+
+    const sfpi::vFloat scalar = Converter::as_float(value);
+
+    for (int d = 0; d < ITERATIONS; d++)
+    {
+        sfpi::vFloat a = sfpi::dst_reg[dst_index_in0 * dst_tile_size_sfpi];
+        sfpi::vFloat b = sfpi::dst_reg[dst_index_in1 * dst_tile_size_sfpi];
+        sfpi::vFloat c = sfpi::dst_reg[dst_index_in2 * dst_tile_size_sfpi];
+        sfpi::vFloat result;
+
+        if constexpr (OP == TernaryOp::FMA)
+        {
+            result = a * b + c;
+        }
+        else if constexpr (OP == TernaryOp::LERP)
+        {
+            result = c * (b - a) + a;
+        }
+        else if constexpr (OP == TernaryOp::ADDCMUL)
+        {
+            result = (scalar * b) * c + a;
+        }
+        else if constexpr (OP == TernaryOp::ADDCDIV)
+        {
+            result = (scalar * b) * _sfpu_reciprocal_<2>(c) + a;
+        }
+        else if constexpr (OP == TernaryOp::CLAMP)
+        {
+            v_if (a < b)
+            {
+                a = b;
+            }
+            v_endif;
+            v_if (a > c)
+            {
+                a = c;
+            }
+            v_endif;
+            result = a;
+        }
+
+        sfpi::dst_reg[dst_index_out * dst_tile_size_sfpi] = result;
+        sfpi::dst_reg++;
+    }
+}
+
+template <bool APPROXIMATION_MODE, TernaryOp OP>
+inline void _sfpu_ternary_init_()
+{
+    if constexpr (OP == TernaryOp::ADDCDIV)
+    {
+        // Initialisation for use of _sfpu_reciprocal_<2> in ADDCDIV.
+        _init_sfpu_reciprocal_<false>();
+    }
+}
+
+} // namespace ckernel::sfpu
@@ -296,7 +296,7 @@ inline void matmul_configure_addrmod(
     }
 }
 
-template <MathFidelity math_fidelity>
+template <MathFidelity math_fidelity, MatmulReuse reuse = MatmulReuse::Auto>
 inline void matmul_configure_mop(
     const std::uint32_t ct_dim,
     const std::uint32_t rt_dim,
@@ -316,7 +316,7 @@ inline void matmul_configure_mop(
 
     constexpr bool high_fidelity = is_high_fidelity(math_fidelity);
 
-    const bool reuse_a        = ct_dim >= rt_dim;
+    const bool reuse_a        = is_matmul_reuse_a(reuse, ct_dim, rt_dim);
     const std::uint32_t t_dim = reuse_a ? rt_dim : ct_dim;
 
     const bool is_in0_16x32 = (in0_tile_r_dim <= FACE_R_DIM) && (in0_tile_c_dim > FACE_C_DIM);
@@ -589,7 +589,7 @@ void run_throttled_sequence(const std::uint32_t t_dim, const bool reuse_a)
  * Level 4: throttle to 40% of max
  * Level 5: throttle to 33% of max
  */
-template <MathFidelity math_fidelity, int THROTTLE_LEVEL>
+template <MathFidelity math_fidelity, int THROTTLE_LEVEL, MatmulReuse reuse = MatmulReuse::Auto>
 inline void matmul_configure_mop_throttled(
     const std::uint32_t ct_dim,
     const std::uint32_t rt_dim,
@@ -612,7 +612,7 @@ inline void matmul_configure_mop_throttled(
         (in0_tile_r_dim == TILE_R_DIM) && (in0_tile_c_dim == TILE_C_DIM) && (in1_tile_r_dim == TILE_R_DIM) && (in1_tile_c_dim == TILE_C_DIM) && !partial_face,
         "MM throttling only enabled for full 32x32 tile size");
 
-    const bool reuse_a        = ct_dim >= rt_dim;
+    const bool reuse_a        = is_matmul_reuse_a(reuse, ct_dim, rt_dim);
     const std::uint32_t t_dim = reuse_a ? rt_dim : ct_dim;
 
     const bool is_in0_16x32 = (in0_tile_r_dim <= FACE_R_DIM) && (in0_tile_c_dim > FACE_C_DIM);
@@ -675,7 +675,7 @@ inline void matmul_configure_mop_throttled(
     tmp.program();
 }
 
-template <MathFidelity math_fidelity, int THROTTLE_LEVEL = 0>
+template <MathFidelity math_fidelity, int THROTTLE_LEVEL = 0, MatmulReuse reuse = MatmulReuse::Auto>
 inline void _llk_math_matmul_init_(
     const std::uint32_t in0_tile_r_dim = TILE_R_DIM,
     const std::uint32_t in0_tile_c_dim = TILE_C_DIM,
@@ -695,7 +695,7 @@ inline void _llk_math_matmul_init_(
         !(transpose && (in1_tile_r_dim == TILE_R_DIM) && (in1_tile_c_dim == FACE_C_DIM)), "in1=32x16 not supported with transpose (no addr_mod handling)");
 
     matmul_configure_addrmod<math_fidelity, THROTTLE_LEVEL>(transpose, in0_tile_r_dim, in0_tile_c_dim, in1_tile_r_dim, in1_tile_c_dim, partial_face);
-    const bool reuse_a        = ct_dim >= rt_dim;
+    const bool reuse_a        = is_matmul_reuse_a(reuse, ct_dim, rt_dim);
     const std::uint32_t t_dim = reuse_a ? rt_dim : ct_dim;
     if (t_dim > 1)
     {
@@ -715,12 +715,12 @@ inline void _llk_math_matmul_init_(
 
     if constexpr (THROTTLE_LEVEL > 0)
     {
-        matmul_configure_mop_throttled<math_fidelity, THROTTLE_LEVEL>(
+        matmul_configure_mop_throttled<math_fidelity, THROTTLE_LEVEL, reuse>(
             ct_dim, rt_dim, in0_tile_r_dim, in0_tile_c_dim, in1_tile_r_dim, in1_tile_c_dim, partial_face);
     }
     else
     {
-        matmul_configure_mop<math_fidelity>(ct_dim, rt_dim, in0_tile_r_dim, in0_tile_c_dim, in1_tile_r_dim, in1_tile_c_dim, partial_face);
+        matmul_configure_mop<math_fidelity, reuse>(ct_dim, rt_dim, in0_tile_r_dim, in0_tile_c_dim, in1_tile_r_dim, in1_tile_c_dim, partial_face);
     }
     math::reset_counters(p_setrwc::SET_ABD_F);
 }
@@ -731,10 +731,10 @@ inline void _llk_math_matmul_uninit_()
     TTI_SETC16(CLR_DVALID_SrcB_Disable_ADDR32, 0);
 }
 
-template <MathFidelity math_fidelity, int THROTTLE_LEVEL = 0>
+template <MathFidelity math_fidelity, int THROTTLE_LEVEL = 0, MatmulReuse reuse = MatmulReuse::Auto>
 inline void _llk_math_matmul_(std::uint32_t dst_index, const std::uint32_t ct_dim = 1, const std::uint32_t rt_dim = 1)
 {
-    const bool reuse_a           = ct_dim >= rt_dim;
+    const bool reuse_a           = is_matmul_reuse_a(reuse, ct_dim, rt_dim);
     const std::uint32_t t_dim    = reuse_a ? rt_dim : ct_dim;
     const std::uint32_t rut_dim  = reuse_a ? ct_dim : rt_dim; // reuse-dim
     constexpr bool high_fidelity = is_high_fidelity(math_fidelity);
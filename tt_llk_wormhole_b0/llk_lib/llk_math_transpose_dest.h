@@ -24,8 +24,9 @@ template <bool transpose_of_faces, bool is_32bit>
 inline void transpose_dest_configure_mop();
 
 // Notes on these template parameters:
-// 1. <transpose_of_faces=false, is_32bit=false>: not supported.
-// 2. <transpose_of_faces=false, is_32bit=true>: 4x 16x16 face transpose; can be combined with _llk_unpack_A_ with transpose_of_faces=true.
+// 1. <transpose_of_faces=false, is_32bit=false>: 4x 16x16 face transpose; can be combined with _llk_pack_transpose_faces_init_.
+// 2. <transpose_of_faces=false, is_32bit=true>: 4x 16x16 face transpose; can be combined with _llk_unpack_A_ with transpose_of_faces=true
+//    or with _llk_pack_transpose_faces_init_.
 // 3. <transpose_of_faces=true, is_32bit=false>: the default case (full 32x32 tile transpose, non-32-bit).
 // 4. <transpose_of_faces=true, is_32bit=true>: full 32x32 tile transpose for 32-bit.
 //
@@ -64,10 +65,15 @@ inline void _llk_math_transpose_dest_(const std::uint32_t dst_index)
 
         cfg_reg_rmw_tensix<ALU_ACC_CTRL_Zero_Flag_disabled_src_RMW>(0);
     }
-    else
+    else if constexpr (transpose_of_faces)
     {
         ckernel_unpack_template::run(2, 2);
     }
+    else
+    {
+        // 4x 16b face transpositions.
+        ckernel_unpack_template::run(4, 0);
+    }
 
     TTI_SETRWC(p_setrwc::CLR_AB, 0, 0, 0, 0, p_setrwc::SET_ABD);
 }
@@ -217,9 +223,19 @@ inline void transpose_dest_configure_mop()
         std::uint32_t Q           = TT_OP_MOVB2D(0, 28, ADDR_MOD_3, p_movb2d::MOV_4_ROWS, 12); // dst += 32
         std::uint32_t EFGHIJKLMNO = lltt::replay_insn(20, 11);
 
-        // The following MOP config simply runs the above 7 instructions in order (when executed with zmask 0b10):
-        ckernel_unpack_template tmp(true, true, EFGHIJKLM, EFGHI, ABCDEFG, P, /* skip A */ Q, /* B */ IJKL, /* skip B */ EFGHIJKLMNO);
-        tmp.program();
+        if (transpose_of_faces)
+        {
+            // The following MOP config simply runs the above 7 instructions in order (when executed with zmask 0b10):
+            ckernel_unpack_template tmp(true, true, EFGHIJKLM, EFGHI, ABCDEFG, P, /* skip A */ Q, /* B */ IJKL, /* skip B */ EFGHIJKLMNO);
+            tmp.program();
+        }
+        else
+        {
+            // Faces stay in place. With halo and B disabled, each iteration of run(4, 0) sees a clear zmask bit and issues only A0:
+            // EFGHIJKLM transposes one face through srcB and steps dst by 16. Skip A holds the same sequence, so a set bit does the same.
+            ckernel_unpack_template tmp(false, false, EFGHIJKLM, TT_OP_NOP, TT_OP_NOP, TT_OP_NOP, EFGHIJKLM, TT_OP_NOP, TT_OP_NOP);
+            tmp.program();
+        }
     }
 }
 
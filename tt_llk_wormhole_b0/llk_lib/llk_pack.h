@@ -103,7 +103,13 @@ inline void _llk_pack_mop_config_(
     }
 }
 
-template <bool is_fp32_dest_acc_en, bool is_tile_dim_reconfig_en = false>
+// is_stoch_rnd_reconfig_en reprograms the rounding of the conversions out of dest to stoch_rnd_mode, see
+// _llk_pack_configure_stoch_rnd_, so None goes back to round to nearest even. Otherwise the rounding is left as it was.
+template <
+    bool is_fp32_dest_acc_en,
+    bool is_tile_dim_reconfig_en  = false,
+    bool is_stoch_rnd_reconfig_en = false,
+    StochRndType stoch_rnd_mode   = StochRndType::None>
 inline void _llk_pack_reconfig_data_format_(
     const std::uint32_t pack_src_format,
     const std::uint32_t pack_dst_format,
@@ -116,6 +122,11 @@ inline void _llk_pack_reconfig_data_format_(
     LLK_ASSERT(num_faces == 1 || num_faces == 2 || num_faces == 4, "num_faces must be 1, 2, or 4");
     reconfig_packer_data_format<is_fp32_dest_acc_en>(pack_src_format, pack_dst_format, tile_size, face_r_dim, num_faces, partial_face);
 
+    if constexpr (is_stoch_rnd_reconfig_en)
+    {
+        _llk_pack_configure_stoch_rnd_<stoch_rnd_mode>();
+    }
+
     if constexpr (is_tile_dim_reconfig_en)
     {
         _llk_pack_mop_config_<false, false>(pack_dst_format, face_r_dim, num_faces, partial_face, narrow_tile);
@@ -196,6 +207,44 @@ inline void _llk_pack_(const std::uint32_t tile_index, const std::uint32_t addre
     }
 }
 
+/*************************************************************************
+ * LLK PACK TRANSPOSE FACES
+ * Makes _llk_pack_ write faces 0, 2, 1, 3 of the dest tile to faces 0, 1, 2, 3 in L1
+ * Packer i always writes L1 face i, so swapping the dest offsets of packers 1 and 2 transposes the faces at no cost per tile
+ * Combined with _llk_math_transpose_dest_<false, is_32bit> (within face transpose only) this gives a full 32x32 tile transpose,
+ * with math skipping the face swap
+ * 16x32 and 16x16 tiles keep their face order when transposed, so only num_faces == 4 changes anything
+ * Must be followed by _llk_pack_transpose_faces_uninit_ before packing untransposed tiles
+ *************************************************************************/
+
+template <DstSync Dst>
+inline void _llk_pack_transpose_faces_init_(const std::uint32_t num_faces = 4)
+{
+    LLK_ASSERT(num_faces == 1 || num_faces == 2 || num_faces == 4, "num_faces must be 1, 2, or 4");
+    if (num_faces != 4)
+    {
+        return;
+    }
+
+    TTI_STALLWAIT(p_stall::STALL_TDMA | p_stall::STALL_THCON, p_stall::PACK); // wait for pack to finish
+    TTI_SETDMAREG(0, 0x00, 0, LO_16(p_gpr_pack::DEST_OFFSET_LO + 0));
+    TTI_SETDMAREG(0, 0x20, 0, LO_16(p_gpr_pack::DEST_OFFSET_LO + 1)); // packer 1 reads face 2
+    TTI_SETDMAREG(0, 0x10, 0, LO_16(p_gpr_pack::DEST_OFFSET_LO + 2)); // packer 2 reads face 1
+    TTI_SETDMAREG(0, 0x30, 0, LO_16(p_gpr_pack::DEST_OFFSET_LO + 3));
+    TTI_SETDMAREG(0, DEST_REGISTER_HALF_SIZE + 0x00, 0, LO_16(p_gpr_pack::DEST_OFFSET_HI + 0));
+    TTI_SETDMAREG(0, DEST_REGISTER_HALF_SIZE + 0x20, 0, LO_16(p_gpr_pack::DEST_OFFSET_HI + 1));
+    TTI_SETDMAREG(0, DEST_REGISTER_HALF_SIZE + 0x10, 0, LO_16(p_gpr_pack::DEST_OFFSET_HI + 2));
+    TTI_SETDMAREG(0, DEST_REGISTER_HALF_SIZE + 0x30, 0, LO_16(p_gpr_pack::DEST_OFFSET_HI + 3));
+    select_packer_dest_registers<Dst>();
+}
+
+template <DstSync Dst>
+inline void _llk_pack_transpose_faces_uninit_()
+{
+    // restore default packer dest offsets
+    _llk_init_packer_dest_offset_registers_<Dst>();
+}
+
 #include "llk_pack_untilize.h"
 
 /*************************************************************************
@@ -206,6 +255,8 @@ inline void _llk_pack_(const std::uint32_t tile_index, const std::uint32_t addre
  * address is the 16B address of where to start packing to (usually the start of the tile row)
  * currently supports only 4 16x16 faces per tile
  * supported output formats are: FP32, FP16_B, BFP8_B, BFP4_B
+ * any width in tiles works, odd ones end with a unit_dim 3 unit; rows narrower than a tile (16 wide) are not supported
+ * block float outputs need 32x32 tiles, 16x32 tiles are packed in pairs so their exponent sections would not line up
  * both dest modes are supported (same usage notes from math apply here)
  * only DstSync::SyncHalf is supported
  * tiles are expected to be split into top and bottom faces in separate halves of the active dest bank
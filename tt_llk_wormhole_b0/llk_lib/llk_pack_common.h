@@ -182,6 +182,30 @@ inline void _llk_pack_reconfig_l1_acc_(const std::uint32_t enable)
     reconfigure_packer_l1_acc(enable);
 }
 
+/**
+ * @brief Sets the rounding of the conversions out of dest for the packs that follow
+ *
+ * Pack and All round stochastically in the gasket (dest format to pack_src_format) and in the packer (pack_src_format
+ * to pack_dst_format), e.g. for fp32 dest packed to Float16_b or Bfp8_b. None and Fpu round to nearest even there. The
+ * FPU bit is left alone, it belongs to the unpack thread (_llk_unpack_configure_stoch_rnd_).
+ *
+ * _llk_unpack_hw_configure_ writes all three bits, so call this once the unpacker is configured, e.g. after
+ * _llk_packer_wait_for_math_done_ for the first tile, or through _llk_pack_reconfig_data_format_.
+ */
+template <StochRndType stoch_rnd_mode>
+inline void _llk_pack_configure_stoch_rnd_()
+{
+    constexpr std::uint32_t pack_stoch_rnd_mask = ALU_ROUNDING_MODE_Gasket_srnd_en_MASK | ALU_ROUNDING_MODE_Packer_srnd_en_MASK;
+    constexpr bool pack_srnd_en                 = (stoch_rnd_mode == StochRndType::All) || (stoch_rnd_mode == StochRndType::Pack);
+
+    // Packs in flight keep the rounding they started with
+    TTI_STALLWAIT(p_stall::STALL_CFG, p_stall::PACK);
+
+    t6_mutex_acquire(mutex::REG_RMW);
+    cfg_reg_rmw_tensix<ALU_FORMAT_SPEC_REG0_SrcA_ADDR32, 0, pack_stoch_rnd_mask>(pack_srnd_en ? pack_stoch_rnd_mask : 0);
+    t6_mutex_release(mutex::REG_RMW);
+}
+
 template <bool untilize = false, ReduceDim dim>
 inline void _llk_pack_reduce_mask_config_()
 {
@@ -133,6 +133,101 @@ inline void _llk_pack_rows_(const std::uint32_t tile_index, const std::uint32_t
     TTI_PACR(ADDR_MOD_1, 0, 0xf, 0, 0, 1, 1);
 }
 
+/**
+ * @brief Packs the rows of a destination register tile selected by an index list to consecutive rows in L1.
+ *
+ * @param tile_index Index of the tile in the destination register to read from
+ * @param address L1 memory address where the gathered rows will be written
+ * @param row_indices Index list, index i selects dest rows [row_indices[i] * rows_per_index, (row_indices[i] + 1) * rows_per_index)
+ * @param num_indices Number of indices in row_indices
+ * @param rows_per_index Rows per index, must match the num_rows given to _llk_pack_rows_init_
+ * @param pack_dst_format Unused, kept for parity with the Blackhole signature
+ *
+ * Gives index_select and embedding lookup on a tile that is already in dest (for example a block of an embedding
+ * table with rows_per_index = embedding_dim / 16). The packer keeps appending to L1, so each index only moves the
+ * Y counter before the MOP runs, and the pack is closed once at the end.
+ */
+inline void _llk_pack_rows_gather_(
+    const std::uint32_t tile_index,
+    const std::uint32_t address,
+    const volatile std::uint32_t *row_indices,
+    const std::uint32_t num_indices,
+    const std::uint32_t rows_per_index,
+    [[maybe_unused]] const std::uint32_t pack_dst_format)
+{
+    constexpr std::uint32_t MAX_ROWS = (TILE_R_DIM * TILE_C_DIM) / FACE_C_DIM;
+
+    set_dst_write_addr(tile_index);
+
+    ckernel::packer::program_packer_destination(address);
+
+    for (std::uint32_t i = 0; i < num_indices; i++)
+    {
+        const std::uint32_t row = row_indices[i] * rows_per_index;
+        LLK_ASSERT(row + rows_per_index <= MAX_ROWS, "Row index is outside of the tile");
+
+        TT_SETADC(p_setadc::PAC, p_setadc::CH_0, p_setadc::SET_Y, row);
+        ckernel::ckernel_template::run();
+    }
+
+    // Close the pack operation
+    TTI_PACR(ADDR_MOD_1, 0, 0xf, 0, 0, 1, 1);
+}
+
+/**
+ * @brief Packs consecutive rows of a destination register tile to the L1 rows selected by an index list.
+ *
+ * @param tile_index Index of the tile in the destination register to read from
+ * @param address L1 memory address of row 0 of the output
+ * @param row_indices Index list, dest rows [i * rows_per_index, (i + 1) * rows_per_index) go to L1 row row_indices[i].
+ *                    Repeated indices must be adjacent, e.g. sorted on the host
+ * @param num_indices Number of indices in row_indices
+ * @param rows_per_index Rows per index, must match the num_rows given to _llk_pack_rows_init_
+ * @param pack_dst_format Output format, used for the size of an L1 row; block float formats are not supported
+ *
+ * With packer L1 accumulation enabled (_llk_pack_reconfig_l1_acc_) this is scatter-add, e.g. for the gradient of an
+ * embedding lookup. The accumulation reads the L1 row while earlier packs may still be writing it, so an index equal
+ * to the previous one waits for the packer to go idle first. Only the previous index is checked, which is why repeats
+ * must be adjacent. Across calls the caller has to do the same, with TTI_STALLWAIT(p_stall::STALL_PACK, p_stall::PACK)
+ * before a call whose first index is the last index of the previous one.
+ */
+inline void _llk_pack_rows_scatter_(
+    const std::uint32_t tile_index,
+    const std::uint32_t address,
+    const volatile std::uint32_t *row_indices,
+    const std::uint32_t num_indices,
+    const std::uint32_t rows_per_index,
+    const std::uint32_t pack_dst_format)
+{
+    constexpr std::uint32_t MAX_ROWS = (TILE_R_DIM * TILE_C_DIM) / FACE_C_DIM;
+    LLK_ASSERT(!IS_BFP_FORMAT(pack_dst_format), "Block float formats cannot be packed row by row");
+    LLK_ASSERT(num_indices * rows_per_index <= MAX_ROWS, "More rows than the tile has");
+
+    // Size of rows_per_index rows in L1, in 16B words
+    const std::uint32_t row_size = SCALE_DATUM_SIZE(pack_dst_format, rows_per_index * FACE_C_DIM) >> 4;
+
+    set_dst_write_addr(tile_index);
+
+    std::uint32_t prev_row_index = 0;
+    for (std::uint32_t i = 0; i < num_indices; i++)
+    {
+        const std::uint32_t row_index = row_indices[i];
+        if (i > 0 && row_index == prev_row_index)
+        {
+            TTI_STALLWAIT(p_stall::STALL_PACK, p_stall::PACK);
+        }
+        prev_row_index = row_index;
+
+        ckernel::packer::program_packer_destination(address + row_index * row_size);
+
+        TT_SETADC(p_setadc::PAC, p_setadc::CH_0, p_setadc::SET_Y, i * rows_per_index);
+        ckernel::ckernel_template::run();
+
+        // Close the pack operation, so that the next index starts a new L1 address
+        TTI_PACR(ADDR_MOD_1, 0, 0xf, 0, 0, 1, 1);
+    }
+}
+
 /**
  * @brief Restore packer addrmods and counters to a safe default state.
  *
@@ -0,0 +1,158 @@
+// SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+
+#include "ckernel.h"
+#include "ckernel_defs.h"
+#include "ckernel_globals.h"
+#include "llk_assert.h"
+#include "llk_defs.h"
+#include "llk_pack_common.h"
+#include "llk_pack_rows.h"
+
+/**
+ * Sparse tile format
+ *
+ * A sparse tile is a SPARSE_TILE_HEADER_SIZE header followed by the faces of the tile that are not all zero, in face
+ * order. The first uint32 of the header is the bitmap of stored faces (bit i set means face i is stored), the rest of
+ * the header is zero. All-zero faces take no L1 space and are rebuilt by the unpacker with UNP_ZEROSRC, see
+ * _llk_unpack_A_sparse_.
+ *
+ * Block float formats are not supported, their exponents are stored apart from the face mantissas.
+ */
+
+/**
+ * @brief Sets up the packer for _llk_pack_sparse_, one face per MOP run
+ *
+ * Uses the row pack MOP of llk_pack_rows.h, so it has to be undone with _llk_pack_rows_uninit_ before dense packs.
+ *
+ * @param face_r_dim Number of rows per face
+ */
+inline void _llk_pack_sparse_init_(const std::uint32_t face_r_dim = FACE_R_DIM)
+{
+    _llk_pack_rows_init_(face_r_dim);
+}
+
+// Packs one face of the dest tile set by set_dst_write_addr to address, as transformed by L1_ADDRESS
+inline void _llk_pack_sparse_face_(const std::uint32_t face, const std::uint32_t address)
+{
+    ckernel::packer::program_packer_destination(address);
+
+    // Faces sit FACE_R_DIM rows apart in dest whatever face_r_dim is
+    TT_SETADC(p_setadc::PAC, p_setadc::CH_0, p_setadc::SET_Y, face * FACE_R_DIM);
+    ckernel::ckernel_template::run();
+
+    // Close the pack operation, so that the next face starts a new L1 address
+    TTI_PACR(ADDR_MOD_1, 0, 0xf, 0, 0, 1, 1);
+}
+
+// Waits for the packer to write the face at address, as transformed by L1_ADDRESS, and tells whether it is all zero
+inline bool _llk_pack_sparse_face_is_zero_(const std::uint32_t address, const std::uint32_t face_size)
+{
+    TTI_STALLWAIT(p_stall::STALL_THCON, p_stall::PACK);
+    tensix_sync();
+
+    volatile std::uint32_t tt_l1_ptr *data = reinterpret_cast<volatile std::uint32_t tt_l1_ptr *>((address + 1) << 4); // Undo L1_ADDRESS
+    const std::uint32_t face_words         = face_size << 2;
+    for (std::uint32_t i = 0; i < face_words; i++)
+    {
+        if (data[i] != 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Packs the faces of a dest tile selected by face_mask into L1 in sparse format
+ *
+ * The packer reads only the faces in face_mask, each straight to the next free slot after the header, and the pack
+ * thread writes the header. The packer itself cannot tell whether a face is zero:
+ * - detect_zero_faces == false: face_mask is the stored set, from the bitmap of a sparse input (see
+ *   _llk_unpack_A_sparse_) for ops that keep zero faces zero, or from the known structure of a block-sparse operand.
+ *   With LLK asserts enabled, each dropped face is first packed to the first face slot and asserted to be zero.
+ * - detect_zero_faces == true: face_mask only bounds the faces that may hold data (0xF to check them all). Each face
+ *   is read back once packed, and an all-zero one is left out of the header and overwritten by the next face. The scan
+ *   stops at the first non-zero word, so it mostly costs a full read of the zero faces only.
+ *
+ * The buffer at address needs room for the header plus the stored faces; add one face for a dropped face that is
+ * checked or read back after the last stored one (never more than num_faces faces). Requires _llk_pack_sparse_init_.
+ *
+ * @tparam detect_zero_faces Read the packed faces back and leave out the all-zero ones
+ * @param tile_index Dest tile to pack
+ * @param address L1 address of the sparse tile, as transformed by L1_ADDRESS
+ * @param face_mask Bitmap of the faces to store or, with detect_zero_faces, of the faces to check
+ * @param pack_dst_format Format of the tile in L1
+ * @param face_r_dim Number of rows per face, as given to _llk_pack_sparse_init_
+ * @param num_faces Number of faces per tile
+ * @return Size of the sparse tile, header included, in L1 address units (16B)
+ */
+template <bool detect_zero_faces = false>
+inline std::uint32_t _llk_pack_sparse_(
+    const std::uint32_t tile_index,
+    const std::uint32_t address,
+    const std::uint32_t face_mask,
+    const std::uint32_t pack_dst_format,
+    const std::uint32_t face_r_dim = FACE_R_DIM,
+    const std::uint32_t num_faces  = 4)
+{
+    LLK_ASSERT(!IS_BFP_FORMAT(pack_dst_format), "Block float formats cannot be packed as sparse tiles");
+    LLK_ASSERT(num_faces == 1 || num_faces == 2 || num_faces == 4, "num_faces must be 1, 2, or 4");
+    LLK_ASSERT((face_mask >> num_faces) == 0, "face_mask selects faces outside of the tile");
+
+    constexpr std::uint32_t header_size = SPARSE_TILE_HEADER_SIZE >> 4;
+    const std::uint32_t face_size       = SCALE_DATUM_SIZE(pack_dst_format, face_r_dim * FACE_C_DIM) >> 4;
+
+    set_dst_write_addr(tile_index);
+
+#ifdef ENABLE_LLK_ASSERT
+    if constexpr (!detect_zero_faces)
+    {
+        // The stored faces overwrite the first face slot afterwards
+        for (std::uint32_t face = 0; face < num_faces; face++)
+        {
+            if ((face_mask & (1u << face)) == 0)
+            {
+                _llk_pack_sparse_face_(face, address + header_size);
+                LLK_ASSERT(_llk_pack_sparse_face_is_zero_(address + header_size, face_size), "face_mask drops a face that is not all zero");
+            }
+        }
+    }
+#endif
+
+    std::uint32_t stored_mask = 0;
+    std::uint32_t num_stored  = 0;
+    for (std::uint32_t face = 0; face < num_faces; face++)
+    {
+        if ((face_mask & (1u << face)) == 0)
+        {
+            continue;
+        }
+
+        const std::uint32_t face_address = address + header_size + num_stored * face_size;
+        _llk_pack_sparse_face_(face, face_address);
+
+        if constexpr (detect_zero_faces)
+        {
+            if (_llk_pack_sparse_face_is_zero_(face_address, face_size))
+            {
+                continue;
+            }
+        }
+        stored_mask |= 1u << face;
+        num_stored++;
+    }
+
+    volatile std::uint32_t tt_l1_ptr *header = reinterpret_cast<volatile std::uint32_t tt_l1_ptr *>((address + 1) << 4); // Undo L1_ADDRESS
+    header[0]                                = stored_mask;
+    header[1]                                = 0;
+    header[2]                                = 0;
+    header[3]                                = 0;
+
+    return header_size + num_stored * face_size;
+}
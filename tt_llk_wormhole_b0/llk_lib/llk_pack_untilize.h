@@ -6,6 +6,7 @@
 
 #include <cstdint>
 
+#include "../../common/tensor_shape.h"
 #include "ckernel.h"
 #include "ckernel_globals.h"
 #include "ckernel_ops.h"
@@ -53,20 +54,39 @@ inline void _llk_pack_untilize_configure_addrmod_()
         .set(ADDR_MOD_3);
 }
 
+// Records into the replay buffer the sequence that closes a row and moves the L1 address of every packer to the next row
+inline void _llk_pack_untilize_record_row_advance_()
+{
+    const std::uint32_t replay_buf_len = 10;
+    lltt::record(ckernel::packer::replay_buf_offset, replay_buf_len);
+    TTI_PACR(ADDR_MOD_3, 0, 0xf, 0, 0, 1, 1); // close block
+    // update l1 address
+    TTI_ADDDMAREG(0, p_gpr_pack::OUTPUT_ADDR, p_gpr_pack::OUTPUT_ADDR, p_gpr_pack::OUTPUT_ADDR_OFFSET);
+    TTI_ADDDMAREG(0, p_gpr_pack::OUTPUT_ADDR + 1, p_gpr_pack::OUTPUT_ADDR + 1, p_gpr_pack::OUTPUT_ADDR_OFFSET);
+    TTI_ADDDMAREG(0, p_gpr_pack::OUTPUT_ADDR + 2, p_gpr_pack::OUTPUT_ADDR + 2, p_gpr_pack::OUTPUT_ADDR_OFFSET);
+    TTI_ADDDMAREG(0, p_gpr_pack::OUTPUT_ADDR + 3, p_gpr_pack::OUTPUT_ADDR + 3, p_gpr_pack::OUTPUT_ADDR_OFFSET);
+    TTI_REG2FLOP(1, 0, 0, 0, THCON_SEC0_REG1_L1_Dest_addr_ADDR32 - THCON_CFGREG_BASE_ADDR32, p_gpr_pack::OUTPUT_ADDR);
+    TTI_REG2FLOP(1, 0, 0, 0, THCON_SEC0_REG8_L1_Dest_addr_ADDR32 - THCON_CFGREG_BASE_ADDR32, p_gpr_pack::OUTPUT_ADDR + 1);
+    TTI_REG2FLOP(1, 0, 0, 0, THCON_SEC1_REG1_L1_Dest_addr_ADDR32 - THCON_CFGREG_BASE_ADDR32, p_gpr_pack::OUTPUT_ADDR + 2);
+    TTI_REG2FLOP(1, 0, 0, 0, THCON_SEC1_REG8_L1_Dest_addr_ADDR32 - THCON_CFGREG_BASE_ADDR32, p_gpr_pack::OUTPUT_ADDR + 3);
+    TTI_NOP;
+}
+
 template <
     std::uint32_t block_ct_dim,
     std::uint32_t full_ct_dim    = block_ct_dim,
     bool diagonal                = false,
     bool narrow_row              = false,
     std::uint32_t row_num_datums = TILE_C_DIM>
-inline void _llk_pack_untilize_mop_config_(const std::uint32_t face_r_dim = FACE_R_DIM, const std::uint32_t num_faces = 4)
+inline void _llk_pack_untilize_mop_config_(
+    const std::uint32_t face_r_dim = FACE_R_DIM, const std::uint32_t num_faces = 4, const std::uint32_t block_tiles = block_ct_dim)
 {
     LLK_ASSERT(num_faces == 1 || num_faces == 2 || num_faces == 4, "num_faces must be 1, 2, or 4");
     const std::uint32_t PACKCNT              = diagonal ? (num_faces > 2 ? num_faces / 2 : num_faces) : ((face_r_dim < FACE_R_DIM) ? 1 : num_faces);
     constexpr std::uint32_t MEGAROW          = 1;
     constexpr std::uint32_t ZERO_OUTPUT_FLAG = p_pacr::P_ZERO_OUTPUT_DISABLED;
     constexpr std::uint32_t MOP_INNER_LOOP   = narrow_row ? (TILE_R_DIM / 4) : (diagonal ? FACE_R_DIM - 1 : 1);
-    constexpr std::uint32_t MOP_OUTER_LOOP   = narrow_row ? 1 : block_ct_dim;
+    const std::uint32_t MOP_OUTER_LOOP       = narrow_row ? 1 : block_tiles;
 
     if constexpr (diagonal)
     {
@@ -109,19 +129,7 @@ inline void _llk_pack_untilize_mop_config_(const std::uint32_t face_r_dim = FACE
 
         if (block_ct_dim != full_ct_dim)
         {
-            const std::uint32_t replay_buf_len = 10;
-            lltt::record(ckernel::packer::replay_buf_offset, replay_buf_len);
-            TTI_PACR(ADDR_MOD_3, 0, 0xf, 0, 0, 1, 1); // close block
-            // update l1 address
-            TTI_ADDDMAREG(0, p_gpr_pack::OUTPUT_ADDR, p_gpr_pack::OUTPUT_ADDR, p_gpr_pack::OUTPUT_ADDR_OFFSET);
-            TTI_ADDDMAREG(0, p_gpr_pack::OUTPUT_ADDR + 1, p_gpr_pack::OUTPUT_ADDR + 1, p_gpr_pack::OUTPUT_ADDR_OFFSET);
-            TTI_ADDDMAREG(0, p_gpr_pack::OUTPUT_ADDR + 2, p_gpr_pack::OUTPUT_ADDR + 2, p_gpr_pack::OUTPUT_ADDR_OFFSET);
-            TTI_ADDDMAREG(0, p_gpr_pack::OUTPUT_ADDR + 3, p_gpr_pack::OUTPUT_ADDR + 3, p_gpr_pack::OUTPUT_ADDR_OFFSET);
-            TTI_REG2FLOP(1, 0, 0, 0, THCON_SEC0_REG1_L1_Dest_addr_ADDR32 - THCON_CFGREG_BASE_ADDR32, p_gpr_pack::OUTPUT_ADDR);
-            TTI_REG2FLOP(1, 0, 0, 0, THCON_SEC0_REG8_L1_Dest_addr_ADDR32 - THCON_CFGREG_BASE_ADDR32, p_gpr_pack::OUTPUT_ADDR + 1);
-            TTI_REG2FLOP(1, 0, 0, 0, THCON_SEC1_REG1_L1_Dest_addr_ADDR32 - THCON_CFGREG_BASE_ADDR32, p_gpr_pack::OUTPUT_ADDR + 2);
-            TTI_REG2FLOP(1, 0, 0, 0, THCON_SEC1_REG8_L1_Dest_addr_ADDR32 - THCON_CFGREG_BASE_ADDR32, p_gpr_pack::OUTPUT_ADDR + 3);
-            TTI_NOP;
+            _llk_pack_untilize_record_row_advance_();
         }
     }
 }
@@ -209,3 +217,83 @@ inline void _llk_pack_untilize_(
         TTI_PACR(ADDR_MOD_2, 0, 0xf, 0, 0, 1, 1); // close block
     }
 }
+
+/*
+Streaming untilize of a tile row of any width.
+full_ct_dim is a runtime value and does not have to be a multiple of block_ct_dim. The row is packed as
+ceil(full_ct_dim / block_ct_dim) blocks of at most block_ct_dim tiles, one dest section each, and every block writes its
+columns straight into the row-major output at a row stride of full_ct_dim tiles, so rows thousands of datums wide need
+neither several launches nor a gather on the host. The last block may be narrower; the MOP stays programmed for
+block_ct_dim and only a narrower block reprograms it, restoring it afterwards, so a ragged row costs two reprograms
+per tile row.
+*/
+
+template <std::uint32_t block_ct_dim>
+inline void _llk_pack_untilize_stream_init_(
+    const std::uint32_t pack_dst_format, const std::uint32_t full_ct_dim, const std::uint32_t face_r_dim = FACE_R_DIM, const std::uint32_t num_faces = 4)
+{
+    static_assert(block_ct_dim > 0 && block_ct_dim <= MAX_TILES_IN_HALF_DEST, "block_ct_dim must be between 1 and MAX_TILES_IN_HALF_DEST");
+    LLK_ASSERT(full_ct_dim > 0, "full_ct_dim must be non-zero");
+    LLK_ASSERT(num_faces == 4, "num_faces must be 4 for streaming untilize");
+
+    _llk_pack_untilize_configure_addrmod_();
+
+    _llk_pack_untilize_mop_config_<block_ct_dim>(face_r_dim, num_faces);
+
+    // Blocks always close their rows through the replay buffer, even when the row is a single block
+    _llk_pack_untilize_record_row_advance_();
+
+    const std::uint32_t output_addr_offset = SCALE_DATUM_SIZE(pack_dst_format, full_ct_dim * (num_faces / 2) * FACE_C_DIM);
+    TT_SETDMAREG(0, LOWER_HALFWORD(output_addr_offset / 16), 0, LO_16(p_gpr_pack::OUTPUT_ADDR_OFFSET)); // store 16B aligned row offset address
+
+    // Pack row by row
+    TT_SETADCXX(p_setadc::PAC, FACE_C_DIM - 1, 0x0);
+}
+
+/**
+ * @brief Packs block block_index of a tile row of full_ct_dim tiles into the row-major output at address.
+ *
+ * address is the 16B aligned start of the tile row in L1, the same for every block of the row. The tiles of the block
+ * are expected at dest tile tile_dst_rt_offset onwards. Requires _llk_pack_untilize_stream_init_ with the same full_ct_dim.
+ */
+template <std::uint32_t block_ct_dim>
+inline void _llk_pack_untilize_stream_(
+    const std::uint32_t address,
+    const std::uint32_t pack_dst_format,
+    const std::uint32_t full_ct_dim,
+    const std::uint32_t block_index,
+    const std::uint32_t face_r_dim                 = FACE_R_DIM,
+    [[maybe_unused]] const std::uint32_t num_faces = 4,
+    const std::uint32_t tile_dst_rt_offset         = 0)
+{
+    LLK_ASSERT(block_index * block_ct_dim < full_ct_dim, "block_index is past the end of the row");
+    LLK_ASSERT(num_faces == 4, "num_faces must be 4 for streaming untilize");
+
+    const std::uint32_t first_tile  = block_index * block_ct_dim;
+    const std::uint32_t block_tiles = (full_ct_dim - first_tile < block_ct_dim) ? full_ct_dim - first_tile : block_ct_dim;
+
+    // The MOP is left programmed for block_ct_dim by _llk_pack_untilize_stream_init_ and by every call
+    const bool narrow_block = block_tiles != block_ct_dim;
+    if (narrow_block)
+    {
+        _llk_pack_untilize_mop_config_<block_ct_dim>(face_r_dim, num_faces, block_tiles);
+    }
+
+    const std::uint32_t block_address = address + SCALE_DATUM_SIZE(pack_dst_format, first_tile * TILE_C_DIM) / 16;
+    program_packer_untilized_row_destination(block_address, pack_dst_format, full_ct_dim);
+
+    const std::uint32_t num_rows = (face_r_dim < FACE_R_DIM) ? face_r_dim : TILE_R_DIM / 4;
+
+    for (std::uint32_t row = 0; row < num_rows; row++)
+    {
+        set_dst_write_addr(tile_dst_rt_offset); // Clear tile counter
+        ckernel::ckernel_template::run();
+        TTI_ADDRCRXY(p_setadc::PAC, 0, 0, 1, 0, 0b0010);      // Read new row in the tile
+        lltt::replay(ckernel::packer::replay_buf_offset, 10); // close the row and update row address
+    }
+
+    if (narrow_block)
+    {
+        _llk_pack_untilize_mop_config_<block_ct_dim>(face_r_dim, num_faces);
+    }
+}
@@ -20,14 +20,14 @@
 using namespace ckernel;
 using namespace ckernel::unpacker;
 
-template <std::uint32_t kernel_broadcast_a = 0, std::uint32_t kernel_broadcast_b = 0>
+template <std::uint32_t kernel_broadcast_a = 0, std::uint32_t kernel_broadcast_b = 0, MatmulReuse reuse = MatmulReuse::Auto>
 inline void _llk_unpack_AB_matmul_mop_config_(
     const std::uint32_t ct_dim, const std::uint32_t rt_dim, const bool unpA_partial_face, const bool unpB_partial_face)
 {
     // in0/inA - loaded to SrcB
     // in1/inB - loaded to SrcA
 
-    const bool reuse_a                      = ct_dim >= rt_dim;
+    const bool reuse_a                      = is_matmul_reuse_a(reuse, ct_dim, rt_dim);
     const std::uint32_t replay_buf_prog_len = (reuse_a && unpA_partial_face) ? 16 : ((!reuse_a && unpB_partial_face) ? 16 : 10);
     const std::uint32_t replay_buf_run_len  = replay_buf_prog_len / 2;
 
@@ -152,7 +152,7 @@ inline void _llk_unpack_AB_matmul_mop_config_(
     tmp.program();
 }
 
-template <std::uint32_t kernel_broadcast_a = 0, std::uint32_t kernel_broadcast_b = 0>
+template <std::uint32_t kernel_broadcast_a = 0, std::uint32_t kernel_broadcast_b = 0, MatmulReuse reuse = MatmulReuse::Auto>
 __attribute__((always_inline)) inline void _llk_unpack_AB_matmul_init_(
     const std::uint32_t transpose       = 0,
     const std::uint32_t ct_dim          = 1,
@@ -205,7 +205,7 @@ __attribute__((always_inline)) inline void _llk_unpack_AB_matmul_init_(
 
     TT_SETDMAREG(0, LOWER_HALFWORD(kt_dim), 0, LO_16(p_gpr_unpack::KT_DIM)); // store kt_dim to gpr for scaling tile size
 
-    _llk_unpack_AB_matmul_mop_config_<kernel_broadcast_a, kernel_broadcast_b>(ct_dim, rt_dim, unpA_partial_face, unpB_partial_face);
+    _llk_unpack_AB_matmul_mop_config_<kernel_broadcast_a, kernel_broadcast_b, reuse>(ct_dim, rt_dim, unpA_partial_face, unpB_partial_face);
 }
 
 inline void _llk_unpack_AB_matmul_uninit_(const std::uint32_t face_r_dim)
@@ -213,7 +213,55 @@ inline void _llk_unpack_AB_matmul_uninit_(const std::uint32_t face_r_dim)
     TT_SETADCXX(p_setadc::UNP_AB, face_r_dim * FACE_C_DIM - 1, 0x0);
 }
 
-template <std::uint32_t kernel_broadcast_a = 0, std::uint32_t kernel_broadcast_b = 0>
+/**
+ * @brief Runs the matmul MOP over ct_dim tiles of a paged input 1
+ *
+ * The MOP advances the srcA base address by one tile per iteration, which is only valid inside a page.
+ * The MOP is therefore split at page boundaries, and the base address of the next page is written
+ * in between, in order with the unpack instructions already issued.
+ */
+inline void _llk_unpack_AB_matmul_run_paged_mop_(
+    const volatile std::uint32_t tt_l1_ptr *page_table_b,
+    const std::uint32_t log2_tiles_per_page_b,
+    const std::uint32_t tile_index_b,
+    const std::uint32_t ct_dim)
+{
+    const std::uint32_t tiles_per_page = 1u << log2_tiles_per_page_b;
+
+    std::uint32_t ct = 0;
+    while (ct < ct_dim)
+    {
+        const std::uint32_t tile_index = tile_index_b + ct;
+        const std::uint32_t tiles_left = tiles_per_page - (tile_index & (tiles_per_page - 1));
+        const std::uint32_t num_tiles  = (tiles_left < (ct_dim - ct)) ? tiles_left : (ct_dim - ct);
+
+        if (ct > 0)
+        {
+            // Crossed into a new page, first tile of the page is at the page base address
+            const std::uint32_t address = page_table_b[tile_index >> log2_tiles_per_page_b];
+            TT_SETDMAREG(0, LOWER_HALFWORD(address), 0, LO_16(p_gpr_unpack::TMP0));
+            TT_SETDMAREG(0, UPPER_HALFWORD(address), 0, HI_16(p_gpr_unpack::TMP0));
+            if (0 == unp_cfg_context)
+            {
+                TTI_REG2FLOP(1, 0, 0, 0, THCON_SEC0_REG3_Base_address_ADDR32 - THCON_CFGREG_BASE_ADDR32, p_gpr_unpack::TMP0);
+            }
+            else
+            {
+                TTI_REG2FLOP(1, 0, 0, 0, THCON_SEC0_REG3_Base_cntx1_address_ADDR32 - THCON_CFGREG_BASE_ADDR32, p_gpr_unpack::TMP0);
+            }
+            TTI_DMANOP;
+        }
+
+        TT_MOP(0, num_tiles - 1, unp_cfg_context == 0 ? 0 : 0xff); // Run the MOP
+        ct += num_tiles;
+    }
+}
+
+/**
+ * When paged_b is set, input 1 is a paged buffer (e.g. the K or V cache of paged attention): base_address_b is
+ * ignored and every input 1 tile address is resolved through page_table_b, see _llk_unpack_get_paged_tile_address_.
+ */
+template <std::uint32_t kernel_broadcast_a = 0, std::uint32_t kernel_broadcast_b = 0, MatmulReuse reuse = MatmulReuse::Auto, bool paged_b = false>
 inline void _llk_unpack_AB_matmul_(
     const std::uint32_t base_address_a,
     const std::uint32_t base_address_b,
@@ -221,18 +269,22 @@ inline void _llk_unpack_AB_matmul_(
     const std::uint32_t tile_index_b,
     const std::uint32_t tile_size_a,
     const std::uint32_t tile_size_b,
-    const bool unpA_partial_face = false,
-    const bool unpB_partial_face = false,
-    std::uint32_t ct_dim         = 1,
-    const std::uint32_t rt_dim   = 1,
-    const std::uint32_t kt_dim   = 1)
+    const bool unpA_partial_face                         = false,
+    const bool unpB_partial_face                         = false,
+    std::uint32_t ct_dim                                 = 1,
+    const std::uint32_t rt_dim                           = 1,
+    const std::uint32_t kt_dim                           = 1,
+    const volatile std::uint32_t tt_l1_ptr *page_table_b = nullptr,
+    const std::uint32_t log2_tiles_per_page_b            = 0)
 {
     // In0/InA -> srcB (supports partial face)
     // In1/InB -> srcA
+    static_assert(!(paged_b && kernel_broadcast_b > 0), "kernel_broadcast on matmul input 1 is not supported with a paged input 1");
+    LLK_ASSERT(!paged_b || page_table_b != nullptr, "Paged matmul unpack requires a page table");
 
     volatile std::uint32_t *cfg = get_cfg_pointer(); // get pointer to registers for current state ID
 
-    const bool reuse_a        = ct_dim >= rt_dim;
+    const bool reuse_a        = is_matmul_reuse_a(reuse, ct_dim, rt_dim);
     const std::uint32_t t_dim = reuse_a ? rt_dim : ct_dim;
 
     if (!reuse_a)
@@ -260,6 +312,11 @@ inline void _llk_unpack_AB_matmul_(
         std::uint32_t next_address_a = base_address_a + next_offset_address_a;
         std::uint32_t address_b      = base_address_b + offset_address_b;
         std::uint32_t next_address_b = base_address_b + next_offset_address_b;
+        if constexpr (paged_b)
+        {
+            // next_address_b is looked up only when the next tile exists, see below
+            address_b = _llk_unpack_get_paged_tile_address_(page_table_b, log2_tiles_per_page_b, tile_size_b, tile_index_b + (reuse_a ? (0) : (t)));
+        }
 
         // Wait for free context
         wait_for_next_context(2);
@@ -336,6 +393,10 @@ inline void _llk_unpack_AB_matmul_(
             }
             if ((t + 1) < t_dim)
             {
+                if constexpr (paged_b)
+                {
+                    next_address_b = _llk_unpack_get_paged_tile_address_(page_table_b, log2_tiles_per_page_b, tile_size_b, tile_index_b + t + 1);
+                }
                 // Let's load one more tile into srcA
                 TT_SETDMAREG(0, LOWER_HALFWORD(next_address_b), 0, LO_16(p_gpr_unpack::TMP0));
                 TT_SETDMAREG(0, UPPER_HALFWORD(next_address_b), 0, HI_16(p_gpr_unpack::TMP0));
@@ -366,7 +427,14 @@ inline void _llk_unpack_AB_matmul_(
             }
         }
 
-        TT_MOP(0, (reuse_a ? ct_dim : rt_dim) - 1, unp_cfg_context == 0 ? 0 : 0xff); // Run the MOP
+        if (paged_b && reuse_a)
+        {
+            _llk_unpack_AB_matmul_run_paged_mop_(page_table_b, log2_tiles_per_page_b, tile_index_b, ct_dim);
+        }
+        else
+        {
+            TT_MOP(0, (reuse_a ? ct_dim : rt_dim) - 1, unp_cfg_context == 0 ? 0 : 0xff); // Run the MOP
+        }
 
         // T6::SEMGET for context release
         t6_semaphore_get(semaphore::UNPACK_SYNC);
@@ -375,3 +443,40 @@ inline void _llk_unpack_AB_matmul_(
         switch_config_context(unp_cfg_context);
     }
 }
+
+/**
+ * @brief Matmul unpack with a paged input 1, e.g. Q x K^T or P x V against a paged KV cache
+ *
+ * Input 1 tiles are addressed by their logical index (tile_index_b + ct) and resolved through page_table_b,
+ * so the K/V tiles of a sequence do not need to be staged into a contiguous buffer first.
+ */
+template <std::uint32_t kernel_broadcast_a = 0, MatmulReuse reuse = MatmulReuse::Auto>
+inline void _llk_unpack_AB_matmul_paged_(
+    const std::uint32_t base_address_a,
+    const volatile std::uint32_t tt_l1_ptr *page_table_b,
+    const std::uint32_t log2_tiles_per_page_b,
+    const std::uint32_t tile_index_a,
+    const std::uint32_t tile_index_b,
+    const std::uint32_t tile_size_a,
+    const std::uint32_t tile_size_b,
+    const bool unpA_partial_face = false,
+    const bool unpB_partial_face = false,
+    std::uint32_t ct_dim         = 1,
+    const std::uint32_t rt_dim   = 1,
+    const std::uint32_t kt_dim   = 1)
+{
+    _llk_unpack_AB_matmul_<kernel_broadcast_a, 0, reuse, true>(
+        base_address_a,
+        0,
+        tile_index_a,
+        tile_index_b,
+        tile_size_a,
+        tile_size_b,
+        unpA_partial_face,
+        unpB_partial_face,
+        ct_dim,
+        rt_dim,
+        kt_dim,
+        page_table_b,
+        log2_tiles_per_page_b);
+}
@@ -228,3 +228,26 @@ inline void _llk_unpack_configure_single_address_(const std::uint32_t address, v
         cfg[THCON_SEC0_REG3_Base_cntx1_address_ADDR32] = address;
     }
 }
+
+/**
+ * @brief Resolves a logical tile index of a paged buffer to its unpacker base address
+ *
+ * A paged buffer (e.g. a paged KV cache) is split into pages of (1 << log2_tiles_per_page) contiguous tiles that can
+ * live anywhere in L1. The page table holds one entry per page: the page base address, in the same units as the
+ * unpacker base address registers.
+ *
+ * @param page_table Pointer to the page table in L1
+ * @param log2_tiles_per_page log2 of the number of tiles in one page
+ * @param tile_size Size of one tile, in unpacker address units
+ * @param tile_index Logical tile index within the paged buffer
+ * @return Unpacker base address of the tile
+ */
+inline std::uint32_t _llk_unpack_get_paged_tile_address_(
+    const volatile std::uint32_t tt_l1_ptr *page_table, const std::uint32_t log2_tiles_per_page, const std::uint32_t tile_size, const std::uint32_t tile_index)
+{
+    const std::uint32_t page        = tile_index >> log2_tiles_per_page;
+    const std::uint32_t tile_offset = tile_index & ((1u << log2_tiles_per_page) - 1);
+    const std::uint32_t address     = page_table[page] + tile_offset * tile_size;
+    LLK_ASSERT(is_valid_L1_address(address), "Paged tile address must be in valid L1 memory region");
+    return address;
+}
@@ -0,0 +1,120 @@
+// SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+
+#include "ckernel.h"
+#include "ckernel_defs.h"
+#include "ckernel_globals.h"
+#include "ckernel_ops.h"
+#include "ckernel_template.h"
+#include "cunpack_common.h"
+#include "llk_assert.h"
+#include "llk_unpack_common.h"
+
+using namespace ckernel;
+using namespace ckernel::unpacker;
+
+/**
+ * Batched unpack to dest for 32-bit sources
+ *
+ * A block form of the unpack_to_dest path of _llk_unpack_A_: the unpacker writes a whole block of tiles straight into
+ * dest with one MOP, and the packer converts them to the output format on the way back to L1 (e.g. Float32 to
+ * Float16_b or Bfp8_b). Math only hands the dest section over to the unpacker (see _llk_math_convert_tiles_).
+ *
+ * Unpacking to dest requires 32-bit data on both sides of the unpacker (Float32 or Int32, dest in 32-bit mode), so only
+ * 32-bit sources are covered. 16-bit and BFP sources (e.g. Float16_b to Bfp8_b) keep going through _llk_unpack_A_ and
+ * the math datacopy, and there is no layout change here: tile to row-major stays with the pack untilize path.
+ */
+
+/**
+ * @brief Programs the MOP that unpacks a block of tiles to dest
+ *
+ * All faces of the block are unpacked by a single UNPACR that steps the L1 face (ch0 z) and the dest face (ch1 z)
+ * together, so the block needs a single context acquire and a single dest handshake.
+ *
+ * @param num_faces Number of faces per tile
+ * @param num_tiles Number of tiles in the block, stored back to back in L1 and written to consecutive dest tiles
+ */
+inline void _llk_unpack_convert_tiles_mop_config_(const std::uint32_t num_faces, const std::uint32_t num_tiles)
+{
+    static constexpr std::uint32_t unpack_srca_to_dest =
+        TT_OP_UNPACR(SrcA, 0b00010001 /*Z inc*/, 0, 0, 0, 1 /* Set OvrdThreadId*/, 0 /*Set Dvalid*/, p_unpacr::RAREFYB_DISABLE, 0, 0, 0, 0, 1); // ch0/ch1 z_inc
+
+    const std::uint32_t outerloop = num_tiles;
+    const std::uint32_t innerloop = num_faces;
+    ckernel_template tmp(outerloop, innerloop, unpack_srca_to_dest);
+    tmp.program();
+}
+
+/**
+ * @brief Initializes the unpacker for convert_tiles
+ *
+ * @param unpack_src_format Format of the tiles in L1, Float32 or Int32
+ * @param unpack_dst_format Format written to dest, Float32 or Int32
+ * @param face_r_dim Number of rows per face
+ * @param num_faces Number of faces per tile
+ * @param num_tiles Number of tiles unpacked by each _llk_unpack_convert_tiles_ call
+ */
+inline void _llk_unpack_convert_tiles_init_(
+    const std::uint32_t unpack_src_format,
+    const std::uint32_t unpack_dst_format,
+    const std::uint32_t face_r_dim = FACE_R_DIM,
+    const std::uint32_t num_faces  = 4,
+    const std::uint32_t num_tiles  = 1)
+{
+    LLK_ASSERT(is_32bit_input(unpack_src_format, unpack_dst_format), "convert_tiles unpacks to dest, which requires 32-bit input and dest formats");
+    LLK_ASSERT(num_faces == 1 || num_faces == 2 || num_faces == 4, "num_faces must be 1, 2, or 4");
+    LLK_ASSERT(num_tiles == 1 || num_faces == 4, "Blocks of more than one tile require num_faces == 4, dest tiles are 4 faces apart");
+
+    cfg_reg_rmw_tensix<THCON_SEC0_REG2_Haloize_mode_RMW>(0);
+    config_unpacker_x_end<p_setadc::UNP_A>(face_r_dim);
+
+    _llk_unpack_convert_tiles_mop_config_(num_faces, num_tiles);
+}
+
+/**
+ * @brief Unpacks a block of tiles to dest, starting at the dest tile math handed over
+ *
+ * @param address L1 address of the first tile of the block
+ * @param unpack_src_format Format of the tiles in L1
+ * @param unpack_dst_format Format written to dest
+ */
+inline void _llk_unpack_convert_tiles_(const std::uint32_t address, const std::uint32_t unpack_src_format, const std::uint32_t unpack_dst_format)
+{
+    LLK_ASSERT(is_valid_L1_address(address), "L1 address must be in valid L1 memory region");
+    LLK_ASSERT(is_32bit_input(unpack_src_format, unpack_dst_format), "convert_tiles unpacks to dest, which requires 32-bit input and dest formats");
+    // Clear z/w start counters
+    TTI_SETADCZW(0b011, 0, 0, 0, 0, 0b1111);
+
+    volatile std::uint32_t tt_reg_ptr *cfg = get_cfg_pointer(); // get pointer to registers for current state ID
+
+    // Wait for free context
+    wait_for_next_context(2);
+
+    const std::uint32_t upk0_reg = (unp_cfg_context == 0) ? THCON_SEC0_REG3_Base_address_ADDR32 : THCON_SEC0_REG3_Base_cntx1_address_ADDR32;
+    cfg[upk0_reg]                = address;
+
+    set_dst_write_addr(unp_cfg_context, unpack_dst_format);
+    wait_for_dest_available();
+
+    // Trisc::SEMPOST for context acquire
+    semaphore_post(semaphore::UNPACK_SYNC);
+
+    // Stall unpacker until pending CFG writes from Trisc have completed
+    TTI_STALLWAIT(p_stall::STALL_UNPACK, p_stall::TRISC_CFG);
+
+    // Run MOP
+    ckernel::ckernel_template::run();
+
+    // T6::SEMGET for context release
+    t6_semaphore_get(semaphore::UNPACK_SYNC);
+
+    unpack_to_dest_tile_done(unp_cfg_context);
+
+    // Switch unpacker config context
+    switch_config_context(unp_cfg_context);
+}
@@ -0,0 +1,108 @@
+// SPDX-FileCopyrightText: © 2026 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+
+#include "ckernel.h"
+#include "ckernel_defs.h"
+#include "ckernel_globals.h"
+#include "ckernel_ops.h"
+#include "ckernel_template.h"
+#include "cunpack_common.h"
+#include "llk_assert.h"
+#include "llk_defs.h"
+#include "llk_unpack_common.h"
+#include "lltt.h"
+
+using namespace ckernel;
+using namespace ckernel::unpacker;
+
+/**
+ * @brief Programs the MOP that unpacks a sparse tile to srcA
+ *
+ * One template iteration per face. Stored faces (zmask bit 0) are unpacked and step the L1 face counter, faces left
+ * out of the tile (zmask bit 1) are zeroed in srcA instead, without moving in L1. srcB gets a zeroed dummy face either
+ * way, as in the _llk_unpack_A_ datacopy MOP.
+ */
+inline void _llk_unpack_A_sparse_mop_config_()
+{
+    static constexpr std::uint32_t unpack_srca =
+        TT_OP_UNPACR(SrcA, 0b1 /*Z inc*/, 0, 0, 0, 1 /* Set OvrdThreadId*/, 1 /*Set Dvalid*/, p_unpacr::RAREFYB_DISABLE, 0, 0, 0, 0, 1);
+
+    lltt::record(0, 4);
+    TTI_UNPACR_NOP(SrcA, p_unpacr_nop::UNP_ZEROSRC);
+    TTI_UNPACR_NOP(SrcA, p_unpacr_nop::UNP_SET_DVALID);
+    TTI_UNPACR_NOP(SrcB, p_unpacr_nop::UNP_ZEROSRC);
+    TTI_UNPACR_NOP(SrcB, p_unpacr_nop::UNP_SET_DVALID);
+    static constexpr std::uint32_t unpack_srca_zerosrc_set_dvalid = lltt::replay_insn(0, 2);
+    static constexpr std::uint32_t unpack_srcb_zerosrc_set_dvalid = lltt::replay_insn(2, 2);
+
+    ckernel_unpack_template tmp(
+        true,                           // unpackB
+        false,                          // unpackHalo
+        unpack_srca,                    // A0_instr
+        TT_OP_NOP,                      // A1_instr
+        TT_OP_NOP,                      // A2_instr
+        TT_OP_NOP,                      // A3_instr
+        unpack_srca_zerosrc_set_dvalid, // skipA_instr
+        unpack_srcb_zerosrc_set_dvalid, // B_instr
+        unpack_srcb_zerosrc_set_dvalid  // skipB_instr
+    );
+    tmp.program();
+}
+
+inline void _llk_unpack_A_sparse_init_(const std::uint32_t face_r_dim = FACE_R_DIM, const std::uint32_t num_faces = 4)
+{
+    LLK_ASSERT(num_faces == 1 || num_faces == 2 || num_faces == 4, "num_faces must be 1, 2, or 4");
+
+    cfg_reg_rmw_tensix<THCON_SEC0_REG2_Haloize_mode_RMW>(0);
+    config_unpacker_x_end<p_setadc::UNP_A>(face_r_dim);
+
+    _llk_unpack_A_sparse_mop_config_();
+}
+
+/**
+ * @brief Unpacks a sparse tile (see llk_pack_sparse.h) to srcA, filling in the faces it leaves out with zeros
+ *
+ * Math consumes the result as it would a dense tile from _llk_unpack_A_, e.g. with an A2D datacopy.
+ *
+ * @param address L1 address of the sparse tile, as transformed by L1_ADDRESS
+ * @param num_faces Number of faces per tile
+ */
+inline void _llk_unpack_A_sparse_(const std::uint32_t address, const std::uint32_t num_faces = 4)
+{
+    LLK_ASSERT(is_valid_L1_address(address), "L1 address must be in valid L1 memory region");
+
+    const volatile std::uint32_t tt_l1_ptr *header = reinterpret_cast<const volatile std::uint32_t tt_l1_ptr *>((address + 1) << 4); // Undo L1_ADDRESS
+    const std::uint32_t zero_faces                 = ~header[0] & ((1u << num_faces) - 1);
+
+    // Clear z/w start counters
+    TTI_SETADCZW(0b011, 0, 0, 0, 0, 0b1111);
+
+    volatile std::uint32_t tt_reg_ptr *cfg = get_cfg_pointer(); // get pointer to registers for current state ID
+
+    // Wait for free context
+    wait_for_next_context(2);
+
+    // Stored faces start right after the header
+    const std::uint32_t upk0_reg = (unp_cfg_context == 0) ? THCON_SEC0_REG3_Base_address_ADDR32 : THCON_SEC0_REG3_Base_cntx1_address_ADDR32;
+    cfg[upk0_reg]                = address + (SPARSE_TILE_HEADER_SIZE >> 4);
+
+    // Trisc::SEMPOST for context acquire
+    semaphore_post(semaphore::UNPACK_SYNC);
+
+    // Stall unpacker until pending CFG writes from Trisc have completed
+    TTI_STALLWAIT(p_stall::STALL_UNPACK, p_stall::TRISC_CFG);
+
+    // Run MOP
+    ckernel_unpack_template::run(num_faces, zero_faces);
+
+    // T6::SEMGET for context release
+    t6_semaphore_get(semaphore::UNPACK_SYNC);
+
+    // Switch unpacker config context
+    switch_config_context(unp_cfg_context);
+}